@@ -0,0 +1,156 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../containers/s21_array.h"
+
+namespace {
+using Hash = s21::array<uint8_t, 32>;
+using Block = s21::array<uint64_t, 64>;
+
+constexpr int kPairs = 1024;
+
+// The element-wise loops s21::array used before its byte-wise paths
+template <typename T, size_t N>
+bool LoopEqual(const s21::array<T, N> &lhs, const s21::array<T, N> &rhs) {
+  for (size_t pos = 0; pos < N; ++pos) {
+    if (!(lhs[pos] == rhs[pos])) return false;
+  }
+  return true;
+}
+
+template <typename T, size_t N>
+bool LoopLess(const s21::array<T, N> &lhs, const s21::array<T, N> &rhs) {
+  for (size_t pos = 0; pos < N; ++pos) {
+    if (lhs[pos] < rhs[pos]) return true;
+    if (rhs[pos] < lhs[pos]) return false;
+  }
+  return false;
+}
+
+template <typename T, size_t N>
+void LoopSwap(s21::array<T, N> &lhs, s21::array<T, N> &rhs) {
+  for (size_t pos = 0; pos < N; ++pos) {
+    T tmp = lhs[pos];
+    lhs[pos] = rhs[pos];
+    rhs[pos] = tmp;
+  }
+}
+
+// Pairs of hashes that share a random length prefix, as sorted keys do
+s21::array<Hash, kPairs> MakeHashes(uint8_t salt) {
+  s21::array<Hash, kPairs> hashes;
+  uint32_t state = 12345;
+  for (Hash &hash : hashes) {
+    state = state * 1103515245u + 12345u;
+    for (size_t pos = 0; pos < hash.size(); ++pos) {
+      hash[pos] = static_cast<uint8_t>(pos);
+    }
+    hash[(state >> 16) % hash.size()] ^= salt;
+  }
+  return hashes;
+}
+
+void BM_HashEqualLoop(benchmark::State &state) {
+  auto lhs = MakeHashes(1);
+  auto rhs = MakeHashes(2);
+  for (auto _ : state) {
+    int equal = 0;
+    for (int i = 0; i < kPairs; ++i) equal += LoopEqual(lhs[i], rhs[i]);
+    benchmark::DoNotOptimize(equal);
+  }
+  state.SetItemsProcessed(state.iterations() * kPairs);
+}
+
+void BM_HashEqual(benchmark::State &state) {
+  auto lhs = MakeHashes(1);
+  auto rhs = MakeHashes(2);
+  for (auto _ : state) {
+    int equal = 0;
+    for (int i = 0; i < kPairs; ++i) equal += lhs[i] == rhs[i];
+    benchmark::DoNotOptimize(equal);
+  }
+  state.SetItemsProcessed(state.iterations() * kPairs);
+}
+
+void BM_HashLessLoop(benchmark::State &state) {
+  auto lhs = MakeHashes(1);
+  auto rhs = MakeHashes(2);
+  for (auto _ : state) {
+    int less = 0;
+    for (int i = 0; i < kPairs; ++i) less += LoopLess(lhs[i], rhs[i]);
+    benchmark::DoNotOptimize(less);
+  }
+  state.SetItemsProcessed(state.iterations() * kPairs);
+}
+
+void BM_HashLess(benchmark::State &state) {
+  auto lhs = MakeHashes(1);
+  auto rhs = MakeHashes(2);
+  for (auto _ : state) {
+    int less = 0;
+    for (int i = 0; i < kPairs; ++i) less += lhs[i] < rhs[i];
+    benchmark::DoNotOptimize(less);
+  }
+  state.SetItemsProcessed(state.iterations() * kPairs);
+}
+
+void BM_BlockSwapLoop(benchmark::State &state) {
+  Block lhs{};
+  Block rhs{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(&lhs);
+    LoopSwap(lhs, rhs);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * sizeof(Block) * 2);
+}
+
+void BM_BlockSwap(benchmark::State &state) {
+  Block lhs{};
+  Block rhs{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(&lhs);
+    lhs.swap(rhs);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * sizeof(Block) * 2);
+}
+
+void BM_HashFillLoop(benchmark::State &state) {
+  s21::array<Hash, kPairs> hashes;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(&hashes);
+    for (int i = 0; i < kPairs; ++i) {
+      Hash &hash = hashes[i];
+      for (size_t pos = 0; pos < hash.size(); ++pos) {
+        hash[pos] = static_cast<uint8_t>(i);
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kPairs);
+}
+
+void BM_HashFill(benchmark::State &state) {
+  s21::array<Hash, kPairs> hashes;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(&hashes);
+    for (int i = 0; i < kPairs; ++i) hashes[i].fill(static_cast<uint8_t>(i));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kPairs);
+}
+}  // namespace
+
+BENCHMARK(BM_HashEqualLoop);
+BENCHMARK(BM_HashEqual);
+BENCHMARK(BM_HashLessLoop);
+BENCHMARK(BM_HashLess);
+BENCHMARK(BM_BlockSwapLoop);
+BENCHMARK(BM_BlockSwap);
+BENCHMARK(BM_HashFillLoop);
+BENCHMARK(BM_HashFill);
+
+BENCHMARK_MAIN();
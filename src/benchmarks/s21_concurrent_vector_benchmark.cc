@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "../containers/s21_concurrent_vector.h"
+#include "../containers/s21_vector.h"
+
+namespace {
+constexpr int kAppendsPerIteration = 1024;
+
+struct Sample {
+  uint64_t timestamp;
+  double value;
+};
+
+// Producers share one vector per benchmark run, thread 0 sets it up
+std::unique_ptr<s21::vector<Sample>> shared_vector;
+std::mutex shared_mutex;
+std::unique_ptr<s21::concurrent_vector<Sample>> shared_concurrent;
+
+void BM_MutexPushBack(benchmark::State &state) {
+  if (state.thread_index() == 0) {
+    shared_vector = std::make_unique<s21::vector<Sample>>();
+  }
+  uint64_t tick = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < kAppendsPerIteration; ++i) {
+      std::lock_guard<std::mutex> lock(shared_mutex);
+      shared_vector->push_back(Sample{++tick, 1.0});
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kAppendsPerIteration);
+  if (state.thread_index() == 0) {
+    shared_vector.reset();
+  }
+}
+
+void BM_ConcurrentPushBack(benchmark::State &state) {
+  if (state.thread_index() == 0) {
+    shared_concurrent = std::make_unique<s21::concurrent_vector<Sample>>();
+  }
+  uint64_t tick = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < kAppendsPerIteration; ++i) {
+      shared_concurrent->push_back(Sample{++tick, 1.0});
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kAppendsPerIteration);
+  if (state.thread_index() == 0) {
+    shared_concurrent.reset();
+  }
+}
+}  // namespace
+
+BENCHMARK(BM_MutexPushBack)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ConcurrentPushBack)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
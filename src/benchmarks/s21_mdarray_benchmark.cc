@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <utility>
+
+#include "../containers/s21_mdarray.h"
+#include "../containers/s21_vector.h"
+
+namespace {
+using Rows = s21::vector<s21::vector<double>>;
+using Matrix = s21::mdarray<double, s21::dynamic_extent, s21::dynamic_extent>;
+
+// One heap block per row, the layout mdarray replaces
+Rows MakeRows(size_t n) {
+  Rows rows;
+  for (size_t i = 0; i < n; ++i) {
+    rows.push_back(s21::vector<double>(n));
+    for (size_t j = 0; j < n; ++j) rows[i][j] = static_cast<double>(i + j);
+  }
+  return rows;
+}
+
+Matrix MakeMatrix(size_t n) {
+  Matrix matrix(n, n);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) matrix(i, j) = static_cast<double>(i + j);
+  }
+  return matrix;
+}
+
+void BM_TransposeRows(benchmark::State &state) {
+  size_t n = static_cast<size_t>(state.range(0));
+  Rows src = MakeRows(n);
+  Rows dst = MakeRows(n);
+  for (auto _ : state) {
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) dst[j][i] = src[i][j];
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void BM_TransposeNaive(benchmark::State &state) {
+  size_t n = static_cast<size_t>(state.range(0));
+  Matrix src = MakeMatrix(n);
+  Matrix dst(n, n);
+  for (auto _ : state) {
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) dst(j, i) = src(i, j);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void BM_TransposeBlocked(benchmark::State &state) {
+  size_t n = static_cast<size_t>(state.range(0));
+  Matrix src = MakeMatrix(n);
+  Matrix dst(n, n);
+  for (auto _ : state) {
+    s21::transpose(std::as_const(src).view(), dst.view());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+// Column sums walk every row once per column
+void BM_ColumnSumRows(benchmark::State &state) {
+  size_t n = static_cast<size_t>(state.range(0));
+  Rows rows = MakeRows(n);
+  for (auto _ : state) {
+    double total = 0;
+    for (size_t j = 0; j < n; ++j) {
+      for (size_t i = 0; i < n; ++i) total += rows[i][j];
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void BM_ColumnSumColumnMajor(benchmark::State &state) {
+  size_t n = static_cast<size_t>(state.range(0));
+  s21::basic_mdarray<double,
+                     s21::extents<s21::dynamic_extent, s21::dynamic_extent>,
+                     s21::layout_left>
+      matrix(n, n);
+  const Matrix source = MakeMatrix(n);
+  s21::copy(source.view(), matrix.view());
+  for (auto _ : state) {
+    double total = 0;
+    for (size_t j = 0; j < n; ++j) {
+      for (size_t i = 0; i < n; ++i) total += matrix(i, j);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+}  // namespace
+
+BENCHMARK(BM_TransposeRows)->Arg(256)->Arg(2048);
+BENCHMARK(BM_TransposeNaive)->Arg(256)->Arg(2048);
+BENCHMARK(BM_TransposeBlocked)->Arg(256)->Arg(2048);
+BENCHMARK(BM_ColumnSumRows)->Arg(256)->Arg(2048);
+BENCHMARK(BM_ColumnSumColumnMajor)->Arg(256)->Arg(2048);
+
+BENCHMARK_MAIN();
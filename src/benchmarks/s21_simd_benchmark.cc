@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include "../containers/s21_simd.h"
+#include "../containers/s21_vector.h"
+
+namespace {
+constexpr int kMissing = -1;
+
+// Values that never equal kMissing, so find and contains scan everything
+template <typename T>
+s21::vector<T> MakeData(size_t size) {
+  s21::vector<T> vec;
+  vec.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    vec.push_back(static_cast<T>((i * 7919) % 100000));
+  }
+  return vec;
+}
+
+template <typename T>
+void BM_StdFind(benchmark::State &state) {
+  s21::vector<T> vec = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        std::find(vec.cbegin(), vec.cend(), static_cast<T>(kMissing)));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_SimdFind(benchmark::State &state) {
+  s21::vector<T> vec = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        s21::simd::find(vec.cbegin(), vec.cend(), static_cast<T>(kMissing)));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_StdCount(benchmark::State &state) {
+  s21::vector<T> vec = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        std::count(vec.cbegin(), vec.cend(), static_cast<T>(7)));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_SimdCount(benchmark::State &state) {
+  s21::vector<T> vec = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        s21::simd::count(vec.cbegin(), vec.cend(), static_cast<T>(7)));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_StdMinElement(benchmark::State &state) {
+  s21::vector<T> vec = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::min_element(vec.cbegin(), vec.cend()));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_SimdMinElement(benchmark::State &state) {
+  s21::vector<T> vec = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::min_element(vec.cbegin(), vec.cend()));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_StdSum(benchmark::State &state) {
+  s21::vector<T> vec = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::accumulate(
+        vec.cbegin(), vec.cend(), s21::simd::sum_type<T>(0)));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_SimdSum(benchmark::State &state) {
+  s21::vector<T> vec = MakeData<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::sum(vec.cbegin(), vec.cend()));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_StdFind, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdFind, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StdFind, float)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdFind, float)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StdCount, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdCount, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StdMinElement, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdMinElement, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StdMinElement, float)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdMinElement, float)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StdSum, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdSum, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StdSum, float)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdSum, float)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "../containers/s21_soa_vector.h"
+#include "../containers/s21_vector.h"
+
+namespace {
+// A 48 byte record of which the scans below read only two fields
+struct Order {
+  int64_t id;
+  double price;
+  double quantity;
+  int64_t customer;
+  int64_t timestamp;
+  int64_t flags;
+};
+
+using OrderColumns =
+    s21::soa_vector<int64_t, double, double, int64_t, int64_t, int64_t>;
+
+void BM_ArrayOfStructsScan(benchmark::State &state) {
+  s21::vector<Order> orders;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    orders.push_back(Order{i, 1.5, 2.0, i % 97, i, 0});
+  }
+  for (auto _ : state) {
+    double total = 0;
+    for (const Order &order : orders) total += order.price * order.quantity;
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_StructOfArraysScan(benchmark::State &state) {
+  OrderColumns orders;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    orders.emplace_back(i, 1.5, 2.0, i % 97, i, 0);
+  }
+  for (auto _ : state) {
+    auto prices = orders.column<1>();
+    auto quantities = orders.column<2>();
+    double total = 0;
+    for (size_t i = 0; i < prices.size(); ++i) {
+      total += prices[i] * quantities[i];
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+BENCHMARK(BM_ArrayOfStructsScan)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_StructOfArraysScan)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_MAIN();
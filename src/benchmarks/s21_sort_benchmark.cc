@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+
+#include "../containers/s21_sort.h"
+#include "../containers/s21_vector.h"
+
+namespace {
+s21::vector<uint32_t> MakeKeys(size_t size) {
+  std::mt19937 gen(42);
+  s21::vector<uint32_t> vec;
+  vec.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    vec.push_back(gen());
+  }
+  return vec;
+}
+
+// Every iteration sorts a fresh copy of the same random keys
+template <typename Sort>
+void RunSort(benchmark::State &state, Sort sort) {
+  const s21::vector<uint32_t> keys = MakeKeys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::vector<uint32_t> vec = keys;
+    state.ResumeTiming();
+    sort(vec);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_StdSort(benchmark::State &state) {
+  RunSort(state, [](s21::vector<uint32_t> &vec) {
+    std::sort(vec.begin(), vec.end());
+  });
+}
+
+void BM_PdqSort(benchmark::State &state) {
+  RunSort(state, [](s21::vector<uint32_t> &vec) { s21::sort(vec); });
+}
+
+void BM_ParallelSort(benchmark::State &state) {
+  RunSort(state, [](s21::vector<uint32_t> &vec) { s21::parallel_sort(vec); });
+}
+
+void BM_RadixSort(benchmark::State &state) {
+  RunSort(state, [](s21::vector<uint32_t> &vec) { s21::radix_sort(vec); });
+}
+}  // namespace
+
+BENCHMARK(BM_StdSort)->Range(1 << 16, 10 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PdqSort)->Range(1 << 16, 10 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParallelSort)
+    ->Range(1 << 16, 10 << 20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RadixSort)
+    ->Range(1 << 16, 10 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
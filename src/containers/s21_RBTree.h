@@ -60,6 +60,9 @@ class RBTree {
   void merge(RBTree& other) noexcept;
   void clear() noexcept;
   void swap(RBTree& other) noexcept;
+  // Replaces the contents with count values that next() yields in key order
+  template <typename Generator>
+  void assign_sorted(size_type count, Generator next);
 
   // Functions for testing
 #ifdef RBTREE_TESTING
@@ -77,6 +80,9 @@ class RBTree {
   void DestroyTree(Node* node) noexcept;
   void CopyTree(const RBTree& other);
   Node* CopyNodes(Node* src_node, Node* parent);
+  template <typename Generator>
+  Node* BuildSorted(size_type count, size_type depth, size_type red_depth,
+                    Generator& next);
   void RotateLeft(Node* node) noexcept;
   void RotateRight(Node* node) noexcept;
   std::pair<Node*, bool> InsertNodeDirectly(Node* root, Node* new_node) noexcept;
@@ -355,6 +361,34 @@ void RBTree<Key, T, unique_values>::swap(RBTree& other) noexcept {
   std::swap(size_, other.size_);
 }
 
+template <typename Key, typename T, bool unique_values>
+template <typename Generator>
+void RBTree<Key, T, unique_values>::assign_sorted(size_type count,
+                                                  Generator next) {
+  clear();
+  if (sentinel_ == nullptr) {
+    sentinel_ = new Node;
+  }
+  if (count == 0) {
+    return;
+  }
+  // Midpoint splits leave every leaf on the two lowest levels, so painting the
+  // lowest one red (unless the tree is perfect) gives equal black heights
+  size_type red_depth = std::numeric_limits<size_type>::max();
+  if (((count + 1) & count) != 0) {
+    red_depth = 0;
+    while ((count >> (red_depth + 1)) != 0) {
+      ++red_depth;
+    }
+  }
+  root_ = BuildSorted(count, 0, red_depth, next);
+  root_->parent = sentinel_;
+  sentinel_->parent = root_;
+  sentinel_->left = SearchMin(root_);
+  sentinel_->right = SearchMax(root_);
+  size_ = count;
+}
+
 #ifdef RBTREE_TESTING
 template <typename Key, typename T, bool unique_values>
 bool RBTree<Key, T, unique_values>::CheckBlackHeight() const noexcept {
@@ -438,6 +472,43 @@ typename RBTree<Key, T, unique_values>::Node* RBTree<Key, T, unique_values>::Cop
   return new_node;
 }
 
+template <typename Key, typename T, bool unique_values>
+template <typename Generator>
+typename RBTree<Key, T, unique_values>::Node*
+RBTree<Key, T, unique_values>::BuildSorted(size_type count, size_type depth,
+                                           size_type red_depth,
+                                           Generator& next) {
+  if (count == 0) {
+    return nullptr;
+  }
+  // Values arrive in order, so the left subtree is built before its parent
+  size_type left_count = (count - 1) / 2;
+  Node* left = BuildSorted(left_count, depth + 1, red_depth, next);
+  Node* node = nullptr;
+  try {
+    node = new Node(next());
+  } catch (...) {
+    DestroyTree(left);
+    throw;
+  }
+  node->color = depth == red_depth ? Color::kRed : Color::kBlack;
+  node->left = left;
+  if (left != nullptr) {
+    left->parent = node;
+  }
+  try {
+    node->right =
+        BuildSorted(count - 1 - left_count, depth + 1, red_depth, next);
+  } catch (...) {
+    DestroyTree(node);
+    throw;
+  }
+  if (node->right != nullptr) {
+    node->right->parent = node;
+  }
+  return node;
+}
+
 template <typename Key, typename T, bool unique_values>
 void RBTree<Key, T, unique_values>::RotateLeft(Node* node) noexcept {
   if (node == nullptr || node->right == nullptr) {
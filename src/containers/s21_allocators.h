@@ -0,0 +1,156 @@
+#ifndef S21_CONTAINERS_SRC_S21_ALLOCATORS_H_
+#define S21_CONTAINERS_SRC_S21_ALLOCATORS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+namespace s21 {
+// The cache line size assumed for alignment and padding. 64 bytes on x86-64
+// and most ARM cores; std::hardware_destructive_interference_size isn't
+// stable across compiler flags, so it isn't used
+inline constexpr size_t cache_line_size = 64;
+
+// Allocates through malloc and can resize a block with realloc. s21::vector
+// uses reallocate to grow buffers of trivially relocatable elements without
+// copying them: realloc extends a block in place when it can, and glibc
+// moves blocks above its mmap threshold (128 KiB by default) with mremap,
+// remapping the pages instead of copying them and never holding the old
+// and the new buffer at the same time
+template <typename T>
+struct malloc_allocator {
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "malloc can't satisfy over-aligned types");
+
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  malloc_allocator() noexcept = default;
+  template <typename U>
+  malloc_allocator(const malloc_allocator<U> &) noexcept {}
+
+  T *allocate(size_t n) {
+    if (n > SIZE_MAX / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    void *block = std::malloc(n * sizeof(T));
+    if (block == nullptr) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(block);
+  }
+
+  void deallocate(T *p, size_t) noexcept { std::free(p); }
+
+  // Resizes the block keeping its bytes; on failure the block is untouched
+  T *reallocate(T *p, size_t, size_t n) {
+    if (n > SIZE_MAX / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    void *block = std::realloc(p, n * sizeof(T));
+    if (block == nullptr) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(block);
+  }
+
+  template <typename U>
+  bool operator==(const malloc_allocator<U> &) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const malloc_allocator<U> &) const noexcept {
+    return false;
+  }
+};
+
+// Allocates blocks that start at an Alignment byte boundary, through the
+// aligned operator new. A cache line by default, which is also enough for
+// aligned AVX-512 loads
+template <typename T, size_t Alignment = cache_line_size>
+struct aligned_allocator {
+  static_assert((Alignment & (Alignment - 1)) == 0,
+                "alignment must be a power of two");
+  static_assert(Alignment >= alignof(T),
+                "alignment can't be weaker than the type's own");
+
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Alignment>;
+  };
+
+  aligned_allocator() noexcept = default;
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Alignment> &) noexcept {}
+
+  T *allocate(size_t n) {
+    if (n > SIZE_MAX / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(
+        ::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+  }
+
+  void deallocate(T *p, size_t) noexcept {
+    ::operator delete(p, std::align_val_t(Alignment));
+  }
+
+  template <typename U>
+  bool operator==(const aligned_allocator<U, Alignment> &) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const aligned_allocator<U, Alignment> &) const noexcept {
+    return false;
+  }
+};
+
+// Hands out no memory at all: a vector with N inline elements and this
+// allocator is limited to its inline buffer, see s21::static_vector.
+// max_size() is N, so growing past it throws std::length_error
+template <typename T, size_t N>
+struct inline_only_allocator {
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = inline_only_allocator<U, N>;
+  };
+
+  inline_only_allocator() noexcept = default;
+  template <typename U>
+  inline_only_allocator(const inline_only_allocator<U, N> &) noexcept {}
+
+  T *allocate(size_t) { throw std::length_error("capacity exceeds N"); }
+  void deallocate(T *, size_t) noexcept {}
+  size_t max_size() const noexcept { return N; }
+
+  template <typename U>
+  bool operator==(const inline_only_allocator<U, N> &) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const inline_only_allocator<U, N> &) const noexcept {
+    return false;
+  }
+};
+
+// The element count an allocator is limited to, N for inline_only_allocator.
+// Containers that rebind it to another unit, like the words of the packed
+// vector<bool>, cap themselves with this instead of the rebound max_size()
+template <typename Allocator>
+struct inline_only_capacity : std::integral_constant<size_t, SIZE_MAX> {};
+
+template <typename T, size_t N>
+struct inline_only_capacity<inline_only_allocator<T, N>>
+    : std::integral_constant<size_t, N> {};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_ALLOCATORS_H_
@@ -2,13 +2,80 @@
 #define S21_CONTAINERS_SRC_S21_ARRAY_H_
 
 #include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 #include "../s21_containers.h"
+#include "s21_allocators.h"
 
 namespace s21 {
+namespace detail {
+// True outside constant evaluation, where the constexpr members of
+// s21::array may take their memcmp, memset and memcpy paths. Without the
+// builtin they always run the plain loops
+constexpr bool RuntimeEvaluated() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return !__builtin_is_constant_evaluated();
+#else
+  return false;
+#endif
+}
+
+// Equal values of these types have equal bytes, so memcmp decides ==.
+// Class types are left out, their operator== may compare anything
+template <typename T>
+inline constexpr bool kBytewiseEqual =
+    (std::is_integral_v<T> || std::is_pointer_v<T> ||
+     std::is_same_v<T, std::byte>) &&
+    std::has_unique_object_representations_v<T>;
+
+// Bytes of these types order like the values, so memcmp decides <
+template <typename T>
+inline constexpr bool kBytewiseLess =
+    sizeof(T) == 1 && kBytewiseEqual<T> &&
+    (std::is_unsigned_v<T> || std::is_same_v<T, std::byte>);
+
+inline constexpr size_t kBytewiseBlock = 64;
+
+// Index of the first differing element, skipping equal blocks with memcmp
+template <typename T>
+size_t BytewiseMismatch(const T* lhs, const T* rhs, size_t count) noexcept {
+  constexpr size_t kBlock = std::max<size_t>(kBytewiseBlock / sizeof(T), 1);
+  size_t pos = 0;
+  while (pos + kBlock <= count &&
+         std::memcmp(lhs + pos, rhs + pos, kBlock * sizeof(T)) == 0) {
+    pos += kBlock;
+  }
+  while (pos < count && lhs[pos] == rhs[pos]) {
+    ++pos;
+  }
+  return pos;
+}
+
+// Swaps two non-overlapping ranges through a stack buffer. Whole blocks
+// have a constant size, so the compiler turns each memcpy into wide loads
+// and stores
+inline void SwapBytes(unsigned char* lhs, unsigned char* rhs,
+                      size_t size) noexcept {
+  unsigned char buffer[kBytewiseBlock];
+  for (; size >= kBytewiseBlock; size -= kBytewiseBlock) {
+    std::memcpy(buffer, lhs, kBytewiseBlock);
+    std::memcpy(lhs, rhs, kBytewiseBlock);
+    std::memcpy(rhs, buffer, kBytewiseBlock);
+    lhs += kBytewiseBlock;
+    rhs += kBytewiseBlock;
+  }
+  std::memcpy(buffer, lhs, size);
+  std::memcpy(lhs, rhs, size);
+  std::memcpy(rhs, buffer, size);
+}
+}  // namespace detail
+
 template <typename T, size_t N>
 struct array {
   using value_type = T;
@@ -19,13 +86,13 @@ struct array {
   using size_type = size_t;
 
   array() = default;
-  array(std::initializer_list<value_type> init_list);
-  array(const array& other);
-  array(array&& other) noexcept;
+  constexpr array(std::initializer_list<value_type> init_list);
+  constexpr array(const array& other) = default;
+  constexpr array(array&& other) = default;
   ~array() = default;
 
-  array& operator=(array&& other) noexcept;
-  array& operator=(array& other) noexcept;
+  constexpr array& operator=(array&& other) noexcept;
+  constexpr array& operator=(const array& other) = default;
 
   constexpr iterator begin() noexcept;
   constexpr const_iterator begin() const noexcept;
@@ -36,58 +103,55 @@ struct array {
   constexpr size_type size() const noexcept;
   constexpr size_type max_size() const noexcept;
 
-  reference at(size_type pos);
-  const_reference at(size_type pos) const;
-  void swap(array& other);
-  void fill(const_reference value);
+  constexpr reference at(size_type pos);
+  constexpr const_reference at(size_type pos) const;
+  constexpr void swap(array& other);
+  constexpr void fill(const_reference value);
 
-  reference operator[](size_type pos) noexcept;
+  constexpr reference operator[](size_type pos) noexcept;
+  constexpr const_reference operator[](size_type pos) const noexcept;
   constexpr const_reference front() const noexcept;
   constexpr const_reference back() const noexcept;
 
   value_type data_[N];
 };
 
+// Everything is constexpr, so tables built by a constexpr function are
+// computed by the compiler. std algorithms aren't constexpr in C++17, hence
+// the plain loops. Start such tables from value-initialized storage:
+//   constexpr auto MakeTable() { s21::array<int, 4> t{}; ...; return t; }
 template <typename T, size_t N>
-array<T, N>::array(std::initializer_list<value_type> init_list) {
+constexpr array<T, N>::array(std::initializer_list<value_type> init_list)
+    : data_() {
   if (init_list.size() != N) {
     throw std::invalid_argument(
         "Initializer list size doesn't match array size");
   }
-  std::copy(init_list.begin(), init_list.end(), data_);
-}
-
-template <typename T, size_t N>
-array<T, N>::array(array&& other) noexcept {
-  std::move(other.begin(), other.end(), data_);
-}
-
-template <typename T, size_t N>
-array<T, N>::array(const array& other) {
-  std::copy(other.begin(), other.end(), data_);
+  size_type pos = 0;
+  for (const_reference value : init_list) {
+    data_[pos++] = value;
+  }
 }
 
+// Moving an array swaps the elements, the source keeps the old ones
 template <typename T, size_t N>
-array<T, N>& array<T, N>::operator=(array&& other) noexcept {
+constexpr array<T, N>& array<T, N>::operator=(array&& other) noexcept {
   if (this != &other) {
-    std::swap(data_, other.data_);
+    swap(other);
   }
   return *this;
 }
 
 template <typename T, size_t N>
-typename s21::array<T, N>::reference s21::array<T, N>::operator[](
+constexpr typename array<T, N>::reference array<T, N>::operator[](
     size_type pos) noexcept {
   return data_[pos];
 }
 
 template <typename T, size_t N>
-array<T, N>& array<T, N>::operator=(array& other) noexcept {
-  if (this == &other) {
-    return *this;
-  }
-  std::copy(other.data_, other.data_ + N, data_);
-  return *this;
+constexpr typename array<T, N>::const_reference array<T, N>::operator[](
+    size_type pos) const noexcept {
+  return data_[pos];
 }
 
 template <typename T, size_t N>
@@ -113,7 +177,7 @@ constexpr typename array<T, N>::const_iterator array<T, N>::end()
 }
 
 template <typename T, size_t N>
-typename array<T, N>::reference array<T, N>::at(size_type pos) {
+constexpr typename array<T, N>::reference array<T, N>::at(size_type pos) {
   if (pos >= N) {
     throw std::out_of_range("pos out of range");
   }
@@ -121,13 +185,26 @@ typename array<T, N>::reference array<T, N>::at(size_type pos) {
 }
 
 template <typename T, size_t N>
-typename array<T, N>::const_reference array<T, N>::at(size_type pos) const {
+constexpr typename array<T, N>::const_reference array<T, N>::at(
+    size_type pos) const {
   if (pos >= N) {
     throw std::out_of_range("pos out of range");
   }
   return data_[pos];
 }
 
+template <typename T, size_t N>
+constexpr typename array<T, N>::const_reference array<T, N>::front()
+    const noexcept {
+  return data_[0];
+}
+
+template <typename T, size_t N>
+constexpr typename array<T, N>::const_reference array<T, N>::back()
+    const noexcept {
+  return data_[N - 1];
+}
+
 template <typename T, size_t N>
 constexpr bool array<T, N>::empty() const noexcept {
   return N == 0;  // В этом месте проверяется размер массива N
@@ -144,16 +221,393 @@ constexpr typename array<T, N>::size_type array<T, N>::max_size()
   return N;
 }
 
+// Trivially copyable elements are swapped as raw bytes
+template <typename T, size_t N>
+constexpr void array<T, N>::swap(array& other) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (detail::RuntimeEvaluated()) {
+      if (this != &other) {
+        detail::SwapBytes(reinterpret_cast<unsigned char*>(data_),
+                          reinterpret_cast<unsigned char*>(other.data_),
+                          sizeof(T) * N);
+      }
+      return;
+    }
+  }
+  for (size_type pos = 0; pos < N; ++pos) {
+    value_type tmp = std::move(data_[pos]);
+    data_[pos] = std::move(other.data_[pos]);
+    other.data_[pos] = std::move(tmp);
+  }
+}
+
+// Single byte elements are filled with memset, the loop is left to the
+// vectorizer otherwise
+template <typename T, size_t N>
+constexpr void array<T, N>::fill(const_reference value) {
+  if constexpr (sizeof(T) == 1 && std::is_trivially_copyable_v<T>) {
+    if (detail::RuntimeEvaluated()) {
+      unsigned char byte;
+      std::memcpy(&byte, &value, 1);
+      std::memset(data_, byte, N);
+      return;
+    }
+  }
+  for (size_type pos = 0; pos < N; ++pos) {
+    data_[pos] = value;
+  }
+}
+
+template <typename T, size_t N>
+constexpr bool operator==(const array<T, N>& lhs, const array<T, N>& rhs) {
+  if constexpr (detail::kBytewiseEqual<T>) {
+    if (detail::RuntimeEvaluated()) {
+      return std::memcmp(lhs.data_, rhs.data_, sizeof(T) * N) == 0;
+    }
+  }
+  for (size_t pos = 0; pos < N; ++pos) {
+    if (!(lhs[pos] == rhs[pos])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T, size_t N>
+constexpr bool operator!=(const array<T, N>& lhs, const array<T, N>& rhs) {
+  return !(lhs == rhs);
+}
+
+// Lexicographical, like std::array. Unsigned bytes compare with memcmp,
+// other integral elements find the first mismatch with it
+template <typename T, size_t N>
+constexpr bool operator<(const array<T, N>& lhs, const array<T, N>& rhs) {
+  if constexpr (detail::kBytewiseLess<T>) {
+    if (detail::RuntimeEvaluated()) {
+      return std::memcmp(lhs.data_, rhs.data_, N) < 0;
+    }
+  } else if constexpr (detail::kBytewiseEqual<T>) {
+    if (detail::RuntimeEvaluated()) {
+      size_t pos = detail::BytewiseMismatch(lhs.data_, rhs.data_, N);
+      return pos < N && lhs.data_[pos] < rhs.data_[pos];
+    }
+  }
+  for (size_t pos = 0; pos < N; ++pos) {
+    if (lhs[pos] < rhs[pos]) {
+      return true;
+    }
+    if (rhs[pos] < lhs[pos]) {
+      return false;
+    }
+  }
+  return false;
+}
+
 template <typename T, size_t N>
-void array<T, N>::swap(array& other) {
-  std::swap_ranges(begin(), end(), other.begin());
+constexpr bool operator>(const array<T, N>& lhs, const array<T, N>& rhs) {
+  return rhs < lhs;
 }
 
 template <typename T, size_t N>
-void array<T, N>::fill(const_reference value) {
-  std::fill(begin(), end(), value);
+constexpr bool operator<=(const array<T, N>& lhs, const array<T, N>& rhs) {
+  return !(rhs < lhs);
 }
 
+template <typename T, size_t N>
+constexpr bool operator>=(const array<T, N>& lhs, const array<T, N>& rhs) {
+  return !(lhs < rhs);
+}
+
+// An s21::array whose elements start at an Alignment byte boundary, for
+// aligned SIMD loads. It is an s21::array everywhere one is expected
+template <typename T, size_t N, size_t Alignment = cache_line_size>
+struct alignas(Alignment) aligned_array : array<T, N> {
+  static_assert((Alignment & (Alignment - 1)) == 0,
+                "alignment must be a power of two");
+
+  using array<T, N>::array;
+};
+
+// N elements that each own a whole cache line, so threads that update
+// neighbouring elements, such as per-thread counters, don't invalidate
+// each other's lines. Costs Alignment bytes per element
+template <typename T, size_t N, size_t Alignment = cache_line_size>
+class padded_array {
+  struct alignas(Alignment) Slot {
+    T value;
+  };
+
+  template <bool kConst>
+  class PaddedIterator;
+
+ public:
+  using value_type = T;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = PaddedIterator<false>;
+  using const_iterator = PaddedIterator<true>;
+  using size_type = size_t;
+
+  constexpr iterator begin() noexcept;
+  constexpr const_iterator begin() const noexcept;
+  constexpr const_iterator cbegin() const noexcept;
+  constexpr iterator end() noexcept;
+  constexpr const_iterator end() const noexcept;
+  constexpr const_iterator cend() const noexcept;
+
+  constexpr bool empty() const noexcept;
+  constexpr size_type size() const noexcept;
+  constexpr size_type max_size() const noexcept;
+
+  constexpr reference at(size_type pos);
+  constexpr const_reference at(size_type pos) const;
+  constexpr reference operator[](size_type pos) noexcept;
+  constexpr const_reference operator[](size_type pos) const noexcept;
+  constexpr reference front() noexcept;
+  constexpr const_reference front() const noexcept;
+  constexpr reference back() noexcept;
+  constexpr const_reference back() const noexcept;
+  constexpr void fill(const_reference value);
+
+  Slot slots_[N];
+};
+
+// Random access iterator that steps over the padding
+template <typename T, size_t N, size_t Alignment>
+template <bool kConst>
+class padded_array<T, N, Alignment>::PaddedIterator {
+  using SlotPointer = std::conditional_t<kConst, const Slot*, Slot*>;
+
+ public:
+  template <bool>
+  friend class PaddedIterator;
+  friend class padded_array;
+
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::conditional_t<kConst, const T&, T&>;
+  using pointer = std::conditional_t<kConst, const T*, T*>;
+
+  constexpr PaddedIterator() noexcept = default;
+  template <bool kOtherConst,
+            typename = std::enable_if_t<kConst || !kOtherConst>>
+  constexpr PaddedIterator(const PaddedIterator<kOtherConst>& it) noexcept
+      : slot_(it.slot_) {}
+
+  constexpr reference operator*() const noexcept { return slot_->value; }
+  constexpr pointer operator->() const noexcept { return &slot_->value; }
+  constexpr reference operator[](difference_type n) const noexcept {
+    return slot_[n].value;
+  }
+
+  constexpr PaddedIterator& operator++() noexcept {
+    ++slot_;
+    return *this;
+  }
+
+  constexpr PaddedIterator operator++(int) noexcept {
+    PaddedIterator tmp = *this;
+    ++slot_;
+    return tmp;
+  }
+
+  constexpr PaddedIterator& operator--() noexcept {
+    --slot_;
+    return *this;
+  }
+
+  constexpr PaddedIterator operator--(int) noexcept {
+    PaddedIterator tmp = *this;
+    --slot_;
+    return tmp;
+  }
+
+  constexpr PaddedIterator& operator+=(difference_type n) noexcept {
+    slot_ += n;
+    return *this;
+  }
+
+  constexpr PaddedIterator& operator-=(difference_type n) noexcept {
+    slot_ -= n;
+    return *this;
+  }
+
+  constexpr PaddedIterator operator+(difference_type n) const noexcept {
+    return PaddedIterator(slot_ + n);
+  }
+
+  friend constexpr PaddedIterator operator+(difference_type n,
+                                            const PaddedIterator& it) {
+    return it + n;
+  }
+
+  constexpr PaddedIterator operator-(difference_type n) const noexcept {
+    return PaddedIterator(slot_ - n);
+  }
+
+  template <bool kOtherConst>
+  constexpr difference_type operator-(
+      const PaddedIterator<kOtherConst>& other) const noexcept {
+    return slot_ - other.slot_;
+  }
+
+  template <bool kOtherConst>
+  constexpr bool operator==(
+      const PaddedIterator<kOtherConst>& other) const noexcept {
+    return slot_ == other.slot_;
+  }
+
+  template <bool kOtherConst>
+  constexpr bool operator!=(
+      const PaddedIterator<kOtherConst>& other) const noexcept {
+    return slot_ != other.slot_;
+  }
+
+  template <bool kOtherConst>
+  constexpr bool operator<(
+      const PaddedIterator<kOtherConst>& other) const noexcept {
+    return slot_ < other.slot_;
+  }
+
+  template <bool kOtherConst>
+  constexpr bool operator>(
+      const PaddedIterator<kOtherConst>& other) const noexcept {
+    return slot_ > other.slot_;
+  }
+
+  template <bool kOtherConst>
+  constexpr bool operator<=(
+      const PaddedIterator<kOtherConst>& other) const noexcept {
+    return slot_ <= other.slot_;
+  }
+
+  template <bool kOtherConst>
+  constexpr bool operator>=(
+      const PaddedIterator<kOtherConst>& other) const noexcept {
+    return slot_ >= other.slot_;
+  }
+
+ private:
+  constexpr explicit PaddedIterator(SlotPointer slot) noexcept
+      : slot_(slot) {}
+
+  SlotPointer slot_ = nullptr;
+};
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::iterator
+padded_array<T, N, Alignment>::begin() noexcept {
+  return iterator(slots_);
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::const_iterator
+padded_array<T, N, Alignment>::begin() const noexcept {
+  return cbegin();
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::const_iterator
+padded_array<T, N, Alignment>::cbegin() const noexcept {
+  return const_iterator(slots_);
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::iterator
+padded_array<T, N, Alignment>::end() noexcept {
+  return iterator(slots_ + N);
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::const_iterator
+padded_array<T, N, Alignment>::end() const noexcept {
+  return cend();
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::const_iterator
+padded_array<T, N, Alignment>::cend() const noexcept {
+  return const_iterator(slots_ + N);
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr bool padded_array<T, N, Alignment>::empty() const noexcept {
+  return N == 0;
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::size_type
+padded_array<T, N, Alignment>::size() const noexcept {
+  return N;
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::size_type
+padded_array<T, N, Alignment>::max_size() const noexcept {
+  return N;
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::reference
+padded_array<T, N, Alignment>::at(size_type pos) {
+  if (pos >= N) {
+    throw std::out_of_range("pos out of range");
+  }
+  return slots_[pos].value;
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::const_reference
+padded_array<T, N, Alignment>::at(size_type pos) const {
+  if (pos >= N) {
+    throw std::out_of_range("pos out of range");
+  }
+  return slots_[pos].value;
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::reference
+padded_array<T, N, Alignment>::operator[](size_type pos) noexcept {
+  return slots_[pos].value;
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::const_reference
+padded_array<T, N, Alignment>::operator[](size_type pos) const noexcept {
+  return slots_[pos].value;
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::reference
+padded_array<T, N, Alignment>::front() noexcept {
+  return slots_[0].value;
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::const_reference
+padded_array<T, N, Alignment>::front() const noexcept {
+  return slots_[0].value;
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::reference
+padded_array<T, N, Alignment>::back() noexcept {
+  return slots_[N - 1].value;
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr typename padded_array<T, N, Alignment>::const_reference
+padded_array<T, N, Alignment>::back() const noexcept {
+  return slots_[N - 1].value;
+}
+
+template <typename T, size_t N, size_t Alignment>
+constexpr void padded_array<T, N, Alignment>::fill(const_reference value) {
+  for (size_type pos = 0; pos < N; ++pos) {
+    slots_[pos].value = value;
+  }
+}
 }  // namespace s21
 
 #endif  // S21_CONTAINERS_SRC_S21_ARRAY_H_
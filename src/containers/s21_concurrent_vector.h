@@ -0,0 +1,666 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONCURRENT_VECTOR_H_
+#define S21_CONTAINERS_SRC_S21_CONCURRENT_VECTOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// A vector that many threads can append to at once without a lock.
+// push_back and emplace_back take the next index with an atomic fetch_add
+// and construct the element in segmented storage like segmented_vector's
+// (segments of 8, 16, 32, ... elements), so nothing ever moves. Every slot
+// has a ready flag, and whichever producer finds the flags after the
+// published size set advances it, so size() always covers a prefix of
+// fully constructed elements. Readers may index and iterate that prefix
+// while producers keep appending. Everything else (clear, moves,
+// destruction) needs exclusive access
+template <typename T, typename Allocator = std::allocator<T>>
+class concurrent_vector {
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "concurrent_vector elements must be nothrow move "
+                "constructible");
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "concurrent_vector elements must not be over-aligned");
+
+  template <typename Reference>
+  class ConcurrentIterator;
+
+ public:
+  // Concurrent vector Member Type
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = ConcurrentIterator<reference>;
+  using const_iterator = ConcurrentIterator<const_reference>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using allocator_type = Allocator;
+
+  // Concurrent vector Member functions
+  concurrent_vector() noexcept(noexcept(Allocator()));
+  explicit concurrent_vector(const Allocator &alloc) noexcept;
+  concurrent_vector(const concurrent_vector &v) = delete;
+  concurrent_vector(concurrent_vector &&v) noexcept;
+  ~concurrent_vector();
+
+  concurrent_vector &operator=(const concurrent_vector &v) = delete;
+  concurrent_vector &operator=(concurrent_vector &&v) noexcept(
+      kMoveAssignNoexcept);
+
+  allocator_type get_allocator() const noexcept;
+
+  // Concurrent vector Element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) noexcept;
+  const_reference operator[](size_type pos) const noexcept;
+  const_reference front() const noexcept;
+
+  // Concurrent vector iterators, end() is the size at the time of the call
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Concurrent vector capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+  size_type capacity() const noexcept;
+
+  // Concurrent vector modifiers. The appends are safe from any number of
+  // threads and return the index of the new element. If a segment can not
+  // be allocated the append throws and publishing stops at its slot
+  size_type push_back(const_reference value);
+  size_type push_back(value_type &&value);
+  void clear() noexcept;
+  void swap(concurrent_vector &other) noexcept;
+
+  template <typename... Args>
+  size_type emplace_back(Args &&...args);
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using byte_allocator =
+      typename alloc_traits::template rebind_alloc<unsigned char>;
+  using byte_traits = std::allocator_traits<byte_allocator>;
+  using Flag = std::atomic<bool>;
+
+  static constexpr size_type kFirstSegmentShift = 3;
+  static constexpr size_type kFirstSegmentSize = size_type(1)
+                                                 << kFirstSegmentShift;
+  static constexpr size_type kMaxSegments =
+      sizeof(size_type) * 8 - kFirstSegmentShift;
+  static constexpr bool kMoveAssignNoexcept =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+  // A segment is one block: the elements followed by their ready flags
+  std::atomic<unsigned char *> segments_[kMaxSegments];
+  std::atomic<size_type> reserved_;
+  std::atomic<size_type> size_;
+  byte_allocator alloc_;
+
+  template <typename... Args>
+  size_type EmplaceSlot(Args &&...args);
+  void Publish() noexcept;
+  unsigned char *EnsureSegment(size_type segment);
+  void DestroyElements() noexcept;
+  void FreeSegments() noexcept;
+  void StealSegments(concurrent_vector &v) noexcept;
+  value_type *SlotAt(size_type index) const noexcept;
+  Flag *FlagAt(size_type index) const noexcept;
+
+  static size_type SegmentOf(size_type index) noexcept;
+  static size_type SegmentStart(size_type segment) noexcept;
+  static size_type SegmentSize(size_type segment) noexcept;
+  static size_type SegmentBytes(size_type segment) noexcept;
+};
+
+// Random access iterator over a snapshot of the published prefix. It walks
+// one segment with a plain pointer and looks the next one up at boundaries
+template <typename T, typename Allocator>
+template <typename Reference>
+class concurrent_vector<T, Allocator>::ConcurrentIterator {
+ public:
+  template <typename>
+  friend class ConcurrentIterator;
+  friend class concurrent_vector<T, Allocator>;
+
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using reference = Reference;
+  using pointer = std::remove_reference_t<Reference> *;
+
+  ConcurrentIterator() = default;
+  template <typename U>
+  ConcurrentIterator(const ConcurrentIterator<U> &it)
+      : vector_(it.vector_),
+        index_(it.index_),
+        current_(it.current_),
+        segment_end_(it.segment_end_) {}
+
+  reference operator*() const { return *current_; }
+  pointer operator->() const { return current_; }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  ConcurrentIterator &operator++() {
+    ++index_;
+    if (++current_ == segment_end_) {
+      Seek(index_);
+    }
+    return *this;
+  }
+
+  ConcurrentIterator operator++(int) {
+    ConcurrentIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  ConcurrentIterator &operator--() {
+    Seek(index_ - 1);
+    return *this;
+  }
+
+  ConcurrentIterator operator--(int) {
+    ConcurrentIterator tmp = *this;
+    --(*this);
+    return tmp;
+  }
+
+  ConcurrentIterator &operator+=(difference_type n) {
+    Seek(index_ + n);
+    return *this;
+  }
+
+  ConcurrentIterator &operator-=(difference_type n) {
+    Seek(index_ - n);
+    return *this;
+  }
+
+  ConcurrentIterator operator+(difference_type n) const {
+    ConcurrentIterator tmp = *this;
+    return tmp += n;
+  }
+
+  friend ConcurrentIterator operator+(difference_type n,
+                                      const ConcurrentIterator &it) {
+    return it + n;
+  }
+
+  ConcurrentIterator operator-(difference_type n) const {
+    ConcurrentIterator tmp = *this;
+    return tmp -= n;
+  }
+
+  template <typename U>
+  difference_type operator-(const ConcurrentIterator<U> &other) const {
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  template <typename U>
+  bool operator==(const ConcurrentIterator<U> &other) const {
+    return index_ == other.index_;
+  }
+  template <typename U>
+  bool operator!=(const ConcurrentIterator<U> &other) const {
+    return index_ != other.index_;
+  }
+  template <typename U>
+  bool operator<(const ConcurrentIterator<U> &other) const {
+    return index_ < other.index_;
+  }
+  template <typename U>
+  bool operator>(const ConcurrentIterator<U> &other) const {
+    return index_ > other.index_;
+  }
+  template <typename U>
+  bool operator<=(const ConcurrentIterator<U> &other) const {
+    return index_ <= other.index_;
+  }
+  template <typename U>
+  bool operator>=(const ConcurrentIterator<U> &other) const {
+    return index_ >= other.index_;
+  }
+
+ private:
+  ConcurrentIterator(const concurrent_vector *vector, size_type index)
+      : vector_(vector) {
+    Seek(index);
+  }
+
+  // Past the last allocated segment only end() can point, it gets no element
+  void Seek(size_type index) {
+    index_ = index;
+    size_type segment = SegmentOf(index);
+    current_ = nullptr;
+    segment_end_ = nullptr;
+    if (segment < kMaxSegments) {
+      unsigned char *block =
+          vector_->segments_[segment].load(std::memory_order_acquire);
+      if (block != nullptr) {
+        pointer segment_begin = reinterpret_cast<T *>(block);
+        segment_end_ = segment_begin + SegmentSize(segment);
+        current_ = segment_begin + (index - SegmentStart(segment));
+      }
+    }
+  }
+
+  const concurrent_vector *vector_ = nullptr;
+  size_type index_ = 0;
+  pointer current_ = nullptr;
+  pointer segment_end_ = nullptr;
+};
+
+// Concurrent vector Member functions
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::concurrent_vector() noexcept(
+    noexcept(Allocator()))
+    : segments_(), reserved_(0), size_(0), alloc_(Allocator()) {}
+
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::concurrent_vector(
+    const Allocator &alloc) noexcept
+    : segments_(), reserved_(0), size_(0), alloc_(alloc) {}
+
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::concurrent_vector(
+    concurrent_vector &&v) noexcept
+    : segments_(), reserved_(0), size_(0), alloc_(std::move(v.alloc_)) {
+  StealSegments(v);
+}
+
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::~concurrent_vector() {
+  DestroyElements();
+  FreeSegments();
+}
+
+// Like s21::vector, the segments only change hands when the allocators
+// allow it, otherwise the elements are moved one by one
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator> &concurrent_vector<T, Allocator>::operator=(
+    concurrent_vector &&v) noexcept(kMoveAssignNoexcept) {
+  if (this == &v) {
+    return *this;
+  }
+  if (kMoveAssignNoexcept || alloc_ == v.alloc_) {
+    DestroyElements();
+    FreeSegments();
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      alloc_ = std::move(v.alloc_);
+    }
+    StealSegments(v);
+  } else {
+    clear();
+    size_type count = v.size();
+    reserve(count);
+    for (size_type index = 0; index < count; ++index) {
+      emplace_back(std::move(v[index]));
+    }
+    v.clear();
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::allocator_type
+concurrent_vector<T, Allocator>::get_allocator() const noexcept {
+  return allocator_type(alloc_);
+}
+
+// Concurrent vector Element access
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::at(size_type pos) {
+  if (pos >= size()) {
+    throw std::out_of_range("accessing concurrent_vector element out of range");
+  }
+  return *SlotAt(pos);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_reference
+concurrent_vector<T, Allocator>::at(size_type pos) const {
+  if (pos >= size()) {
+    throw std::out_of_range("accessing concurrent_vector element out of range");
+  }
+  return *SlotAt(pos);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::operator[](size_type pos) noexcept {
+  return *SlotAt(pos);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_reference
+concurrent_vector<T, Allocator>::operator[](size_type pos) const noexcept {
+  return *SlotAt(pos);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_reference
+concurrent_vector<T, Allocator>::front() const noexcept {
+  return *SlotAt(0);
+}
+
+// Concurrent vector iterators
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::begin() noexcept {
+  return iterator(this, 0);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_iterator
+concurrent_vector<T, Allocator>::begin() const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_iterator
+concurrent_vector<T, Allocator>::cbegin() const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::end() noexcept {
+  return iterator(this, size());
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_iterator
+concurrent_vector<T, Allocator>::end() const noexcept {
+  return const_iterator(this, size());
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_iterator
+concurrent_vector<T, Allocator>::cend() const noexcept {
+  return const_iterator(this, size());
+}
+
+// Concurrent vector capacity
+template <typename T, typename Allocator>
+bool concurrent_vector<T, Allocator>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::size() const noexcept {
+  return size_.load(std::memory_order_acquire);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::max_size() const noexcept {
+  return byte_traits::max_size(alloc_) / (sizeof(T) + sizeof(Flag));
+}
+
+// Safe to call while other threads append
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("concurrent_vector size exceeds max_size");
+  }
+  if (size != 0) {
+    for (size_type segment = 0; segment <= SegmentOf(size - 1); ++segment) {
+      EnsureSegment(segment);
+    }
+  }
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::capacity() const noexcept {
+  size_type segment = 0;
+  while (segment < kMaxSegments &&
+         segments_[segment].load(std::memory_order_acquire) != nullptr) {
+    ++segment;
+  }
+  return SegmentStart(segment);
+}
+
+// Concurrent vector modifiers
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::push_back(const_reference value) {
+  return emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::push_back(value_type &&value) {
+  return EmplaceSlot(std::move(value));
+}
+
+// A constructor that may throw runs before a slot is taken, so a failed
+// append never leaves a hole that would stall every later element
+template <typename T, typename Allocator>
+template <typename... Args>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::emplace_back(Args &&...args) {
+  if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+    return EmplaceSlot(std::forward<Args>(args)...);
+  } else {
+    T value(std::forward<Args>(args)...);
+    return EmplaceSlot(std::move(value));
+  }
+}
+
+// Keeps the segments, like s21::vector keeps its capacity
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::clear() noexcept {
+  DestroyElements();
+  reserved_.store(0, std::memory_order_relaxed);
+  size_.store(0, std::memory_order_release);
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::swap(concurrent_vector &other) noexcept {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(alloc_, other.alloc_);
+  }
+  for (size_type segment = 0; segment < kMaxSegments; ++segment) {
+    segments_[segment].store(
+        other.segments_[segment].exchange(segments_[segment].load()));
+  }
+  reserved_.store(other.reserved_.exchange(reserved_.load()));
+  size_.store(other.size_.exchange(size_.load()));
+}
+
+// Private functions
+template <typename T, typename Allocator>
+template <typename... Args>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::EmplaceSlot(Args &&...args) {
+  // The limit is checked before the slot is taken, so a full vector keeps
+  // its count
+  size_type index = reserved_.load(std::memory_order_relaxed);
+  do {
+    if (SegmentOf(index) >= kMaxSegments) {
+      throw std::length_error("concurrent_vector size exceeds max_size");
+    }
+  } while (!reserved_.compare_exchange_weak(index, index + 1,
+                                            std::memory_order_relaxed));
+  size_type segment = SegmentOf(index);
+  unsigned char *block = EnsureSegment(segment);
+  size_type offset = index - SegmentStart(segment);
+  ::new (static_cast<void *>(reinterpret_cast<T *>(block) + offset))
+      T(std::forward<Args>(args)...);
+  reinterpret_cast<Flag *>(block + SegmentSize(segment) * sizeof(T))[offset]
+      .store(true);
+  Publish();
+  return index;
+}
+
+// Moves size_ over every ready slot. Flags and size_ are sequentially
+// consistent, so of two producers finishing neighbouring slots at least one
+// sees the other's flag and no ready element is left unpublished
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::Publish() noexcept {
+  size_type published = size_.load();
+  while (true) {
+    Flag *flag = FlagAt(published);
+    if (flag == nullptr || !flag->load()) {
+      return;
+    }
+    // A failed exchange reloads published, which only ever grows
+    if (size_.compare_exchange_weak(published, published + 1)) {
+      ++published;
+    }
+  }
+}
+
+// Racing producers may both allocate a segment, the loser frees its block
+template <typename T, typename Allocator>
+unsigned char *concurrent_vector<T, Allocator>::EnsureSegment(
+    size_type segment) {
+  unsigned char *block = segments_[segment].load(std::memory_order_acquire);
+  if (block != nullptr) {
+    return block;
+  }
+  unsigned char *fresh = byte_traits::allocate(alloc_, SegmentBytes(segment));
+  Flag *flags =
+      reinterpret_cast<Flag *>(fresh + SegmentSize(segment) * sizeof(T));
+  for (size_type i = 0; i < SegmentSize(segment); ++i) {
+    ::new (static_cast<void *>(flags + i)) Flag(false);
+  }
+  if (segments_[segment].compare_exchange_strong(block, fresh,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+    return fresh;
+  }
+  byte_traits::deallocate(alloc_, fresh, SegmentBytes(segment));
+  return block;
+}
+
+// Only slots whose flag is set hold an element, a reserved slot whose
+// segment could not be allocated does not. Such a segment stays null while
+// later ones may hold elements, so every allocated segment is walked
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::DestroyElements() noexcept {
+  size_type reserved = reserved_.load(std::memory_order_relaxed);
+  for (size_type segment = 0;
+       segment < kMaxSegments && SegmentStart(segment) < reserved;
+       ++segment) {
+    unsigned char *block = segments_[segment].load(std::memory_order_relaxed);
+    if (block == nullptr) {
+      continue;
+    }
+    T *slots = reinterpret_cast<T *>(block);
+    Flag *flags =
+        reinterpret_cast<Flag *>(block + SegmentSize(segment) * sizeof(T));
+    size_type count =
+        std::min(SegmentSize(segment), reserved - SegmentStart(segment));
+    for (size_type i = 0; i < count; ++i) {
+      if (flags[i].load(std::memory_order_relaxed)) {
+        std::destroy_at(slots + i);
+        flags[i].store(false, std::memory_order_relaxed);
+      }
+    }
+  }
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::FreeSegments() noexcept {
+  for (size_type segment = 0; segment < kMaxSegments; ++segment) {
+    unsigned char *block = segments_[segment].exchange(nullptr);
+    if (block != nullptr) {
+      byte_traits::deallocate(alloc_, block, SegmentBytes(segment));
+    }
+  }
+  reserved_.store(0, std::memory_order_relaxed);
+  size_.store(0, std::memory_order_relaxed);
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::StealSegments(
+    concurrent_vector &v) noexcept {
+  for (size_type segment = 0; segment < kMaxSegments; ++segment) {
+    segments_[segment].store(v.segments_[segment].exchange(nullptr));
+  }
+  reserved_.store(v.reserved_.exchange(0));
+  size_.store(v.size_.exchange(0));
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::value_type *
+concurrent_vector<T, Allocator>::SlotAt(size_type index) const noexcept {
+  size_type segment = SegmentOf(index);
+  return reinterpret_cast<T *>(
+             segments_[segment].load(std::memory_order_acquire)) +
+         (index - SegmentStart(segment));
+}
+
+// Null when the slot's segment is not allocated yet
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::Flag *
+concurrent_vector<T, Allocator>::FlagAt(size_type index) const noexcept {
+  size_type segment = SegmentOf(index);
+  if (segment >= kMaxSegments) {
+    return nullptr;
+  }
+  unsigned char *block = segments_[segment].load(std::memory_order_acquire);
+  if (block == nullptr) {
+    return nullptr;
+  }
+  return reinterpret_cast<Flag *>(block + SegmentSize(segment) * sizeof(T)) +
+         (index - SegmentStart(segment));
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::SegmentOf(size_type index) noexcept {
+  size_type shifted = (index >> kFirstSegmentShift) + 1;
+#if defined(__GNUC__) || defined(__clang__)
+  return sizeof(unsigned long long) * 8 - 1 -
+         __builtin_clzll(static_cast<unsigned long long>(shifted));
+#else
+  size_type segment = 0;
+  while (shifted >>= 1) {
+    ++segment;
+  }
+  return segment;
+#endif
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::SegmentStart(size_type segment) noexcept {
+  return (kFirstSegmentSize << segment) - kFirstSegmentSize;
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::SegmentSize(size_type segment) noexcept {
+  return kFirstSegmentSize << segment;
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::SegmentBytes(size_type segment) noexcept {
+  return SegmentSize(segment) * (sizeof(T) + sizeof(Flag));
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_CONCURRENT_VECTOR_H_
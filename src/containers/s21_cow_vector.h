@@ -0,0 +1,456 @@
+#ifndef S21_CONTAINERS_SRC_S21_COW_VECTOR_H_
+#define S21_CONTAINERS_SRC_S21_COW_VECTOR_H_
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// A copy-on-write vector for read-mostly snapshots. Copies share one
+// reference-counted s21::vector, so copying is O(1) and any number of live
+// snapshots cost one buffer. The first call that could modify a shared
+// vector, including the non-const begin(), operator[] and data(), gives this
+// copy its own buffer. Const access never copies. Copies may be read,
+// destroyed and detached from different threads, as with std::shared_ptr.
+// Mutable references and iterators obtained before the vector was copied
+// write into the shared buffer, so take them again after copying
+template <typename T, typename Allocator = std::allocator<T>>
+class cow_vector {
+ public:
+  // Cow vector Member Type
+  using vector_type = vector<T, Allocator>;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using allocator_type = Allocator;
+
+  // Cow vector Member functions
+  cow_vector() noexcept;
+  explicit cow_vector(size_type n);
+  cow_vector(std::initializer_list<value_type> const &items);
+  explicit cow_vector(const vector_type &v);
+  explicit cow_vector(vector_type &&v);
+  cow_vector(const cow_vector &v) noexcept;
+  cow_vector(cow_vector &&v) noexcept;
+  ~cow_vector();
+
+  cow_vector &operator=(const cow_vector &v) noexcept;
+  cow_vector &operator=(cow_vector &&v) noexcept;
+
+  // Cow vector Element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const noexcept;
+  reference front();
+  const_reference front() const noexcept;
+  reference back();
+  const_reference back() const noexcept;
+  T *data();
+  const T *data() const noexcept;
+
+  // Cow vector iterators
+  iterator begin();
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end();
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Cow vector capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+  size_type capacity() const noexcept;
+  void shrink_to_fit();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
+
+  // Cow vector modifiers
+  void clear() noexcept;
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type &&value);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void pop_back();
+  void swap(cow_vector &other) noexcept;
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+
+  // Cow vector sharing
+  // Number of cow_vectors sharing the buffer, 0 for an empty vector that
+  // never allocated one
+  size_type use_count() const noexcept;
+
+ private:
+  struct Shared {
+    template <typename... Args>
+    explicit Shared(Args &&...args)
+        : refs(1), items(std::forward<Args>(args)...) {}
+
+    std::atomic<size_type> refs;
+    vector_type items;
+  };
+
+  struct Releaser {
+    void operator()(Shared *shared) const noexcept { Release(shared); }
+  };
+
+  // The buffer this vector shared before detaching. Operations keep it
+  // alive until they return, since their arguments may point into it
+  using Detached = std::unique_ptr<Shared, Releaser>;
+
+  Shared *shared_;
+
+  Detached Detach(size_type extra = 0);
+  static void Release(Shared *shared) noexcept;
+};
+
+// Cow vector Member functions
+template <typename T, typename Allocator>
+cow_vector<T, Allocator>::cow_vector() noexcept : shared_(nullptr) {}
+
+template <typename T, typename Allocator>
+cow_vector<T, Allocator>::cow_vector(size_type n)
+    : shared_(new Shared(n)) {}
+
+template <typename T, typename Allocator>
+cow_vector<T, Allocator>::cow_vector(
+    std::initializer_list<value_type> const &items)
+    : shared_(new Shared(items)) {}
+
+template <typename T, typename Allocator>
+cow_vector<T, Allocator>::cow_vector(const vector_type &v)
+    : shared_(new Shared(v)) {}
+
+template <typename T, typename Allocator>
+cow_vector<T, Allocator>::cow_vector(vector_type &&v)
+    : shared_(new Shared(std::move(v))) {}
+
+template <typename T, typename Allocator>
+cow_vector<T, Allocator>::cow_vector(const cow_vector &v) noexcept
+    : shared_(v.shared_) {
+  if (shared_ != nullptr) {
+    shared_->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+template <typename T, typename Allocator>
+cow_vector<T, Allocator>::cow_vector(cow_vector &&v) noexcept
+    : shared_(std::exchange(v.shared_, nullptr)) {}
+
+template <typename T, typename Allocator>
+cow_vector<T, Allocator>::~cow_vector() {
+  Release(shared_);
+}
+
+template <typename T, typename Allocator>
+cow_vector<T, Allocator> &cow_vector<T, Allocator>::operator=(
+    const cow_vector &v) noexcept {
+  cow_vector tmp(v);
+  swap(tmp);
+  return *this;
+}
+
+template <typename T, typename Allocator>
+cow_vector<T, Allocator> &cow_vector<T, Allocator>::operator=(
+    cow_vector &&v) noexcept {
+  cow_vector tmp(std::move(v));
+  swap(tmp);
+  return *this;
+}
+
+// Cow vector Element access
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::reference cow_vector<T, Allocator>::at(
+    size_type pos) {
+  if (pos >= size()) {
+    throw std::out_of_range("accessing cow_vector element out of range");
+  }
+  return (*this)[pos];
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::const_reference
+cow_vector<T, Allocator>::at(size_type pos) const {
+  if (pos >= size()) {
+    throw std::out_of_range("accessing cow_vector element out of range");
+  }
+  return (*this)[pos];
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::reference
+cow_vector<T, Allocator>::operator[](size_type pos) {
+  return data()[pos];
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::const_reference
+cow_vector<T, Allocator>::operator[](size_type pos) const noexcept {
+  return data()[pos];
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::reference cow_vector<T, Allocator>::front() {
+  return data()[0];
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::const_reference
+cow_vector<T, Allocator>::front() const noexcept {
+  return data()[0];
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::reference cow_vector<T, Allocator>::back() {
+  return data()[size() - 1];
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::const_reference
+cow_vector<T, Allocator>::back() const noexcept {
+  return data()[size() - 1];
+}
+
+template <typename T, typename Allocator>
+T *cow_vector<T, Allocator>::data() {
+  if (shared_ == nullptr) {
+    return nullptr;
+  }
+  Detach();
+  return shared_->items.data();
+}
+
+template <typename T, typename Allocator>
+const T *cow_vector<T, Allocator>::data() const noexcept {
+  return shared_ == nullptr ? nullptr : shared_->items.cbegin();
+}
+
+// Cow vector iterators
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::iterator cow_vector<T, Allocator>::begin() {
+  return data();
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::const_iterator
+cow_vector<T, Allocator>::begin() const noexcept {
+  return data();
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::const_iterator
+cow_vector<T, Allocator>::cbegin() const noexcept {
+  return data();
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::iterator cow_vector<T, Allocator>::end() {
+  return data() + size();
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::const_iterator
+cow_vector<T, Allocator>::end() const noexcept {
+  return data() + size();
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::const_iterator
+cow_vector<T, Allocator>::cend() const noexcept {
+  return data() + size();
+}
+
+// Cow vector capacity
+template <typename T, typename Allocator>
+bool cow_vector<T, Allocator>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::size_type cow_vector<T, Allocator>::size()
+    const noexcept {
+  return shared_ == nullptr ? 0 : shared_->items.size();
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::size_type
+cow_vector<T, Allocator>::max_size() const noexcept {
+  return vector_type().max_size();
+}
+
+template <typename T, typename Allocator>
+void cow_vector<T, Allocator>::reserve(size_type size) {
+  if (size > capacity()) {
+    Detached old = Detach(size - this->size());
+    shared_->items.reserve(size);
+  }
+}
+
+// A shared buffer is this copy's capacity too
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::size_type
+cow_vector<T, Allocator>::capacity() const noexcept {
+  return shared_ == nullptr ? 0 : shared_->items.capacity();
+}
+
+template <typename T, typename Allocator>
+void cow_vector<T, Allocator>::shrink_to_fit() {
+  if (shared_ != nullptr) {
+    Detached old = Detach();
+    shared_->items.shrink_to_fit();
+  }
+}
+
+template <typename T, typename Allocator>
+void cow_vector<T, Allocator>::resize(size_type count) {
+  Detached old = Detach(count > size() ? count - size() : 0);
+  shared_->items.resize(count);
+}
+
+template <typename T, typename Allocator>
+void cow_vector<T, Allocator>::resize(size_type count, const_reference value) {
+  Detached old = Detach(count > size() ? count - size() : 0);
+  shared_->items.resize(count, value);
+}
+
+// Cow vector modifiers
+// Drops a shared buffer instead of copying it only to empty the copy
+template <typename T, typename Allocator>
+void cow_vector<T, Allocator>::clear() noexcept {
+  if (shared_ == nullptr) {
+    return;
+  }
+  if (shared_->refs.load(std::memory_order_acquire) == 1) {
+    shared_->items.clear();
+  } else {
+    Release(std::exchange(shared_, nullptr));
+  }
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::iterator cow_vector<T, Allocator>::insert(
+    const_iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::iterator cow_vector<T, Allocator>::insert(
+    const_iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::iterator cow_vector<T, Allocator>::erase(
+    const_iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::iterator cow_vector<T, Allocator>::erase(
+    const_iterator first, const_iterator last) {
+  if (first == last) {
+    return begin() + (first - cbegin());
+  }
+  size_type index = first - cbegin();
+  size_type count = last - first;
+  Detached old = Detach();
+  const_iterator items = shared_->items.cbegin();
+  return shared_->items.erase(items + index, items + index + count);
+}
+
+template <typename T, typename Allocator>
+void cow_vector<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void cow_vector<T, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+void cow_vector<T, Allocator>::pop_back() {
+  Detached old = Detach();
+  shared_->items.pop_back();
+}
+
+template <typename T, typename Allocator>
+void cow_vector<T, Allocator>::swap(cow_vector &other) noexcept {
+  std::swap(shared_, other.shared_);
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename cow_vector<T, Allocator>::iterator cow_vector<T, Allocator>::emplace(
+    const_iterator pos, Args &&...args) {
+  size_type index = pos - cbegin();
+  Detached old = Detach(1);
+  return shared_->items.emplace(shared_->items.cbegin() + index,
+                                std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename cow_vector<T, Allocator>::reference
+cow_vector<T, Allocator>::emplace_back(Args &&...args) {
+  Detached old = Detach(1);
+  return shared_->items.emplace_back(std::forward<Args>(args)...);
+}
+
+// Cow vector sharing
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::size_type
+cow_vector<T, Allocator>::use_count() const noexcept {
+  return shared_ == nullptr ? 0 : shared_->refs.load(std::memory_order_acquire);
+}
+
+// Private functions
+// Makes the buffer this vector's own. The copy reserves room for extra more
+// elements, so the operation that detached does not reallocate it again.
+// The acquire load pairs with the release in Release: once the other owners
+// are gone, their reads of the buffer happen before our writes
+template <typename T, typename Allocator>
+typename cow_vector<T, Allocator>::Detached cow_vector<T, Allocator>::Detach(
+    size_type extra) {
+  if (shared_ == nullptr) {
+    shared_ = new Shared();
+    return Detached();
+  }
+  if (shared_->refs.load(std::memory_order_acquire) == 1) {
+    return Detached();
+  }
+  vector_type &items = shared_->items;
+  std::unique_ptr<Shared> copy(new Shared(items.get_allocator()));
+  copy->items.reserve(items.size() + extra);
+  copy->items.assign(items.cbegin(), items.cend());
+  return Detached(std::exchange(shared_, copy.release()));
+}
+
+template <typename T, typename Allocator>
+void cow_vector<T, Allocator>::Release(Shared *shared) noexcept {
+  if (shared != nullptr &&
+      shared->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete shared;
+  }
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_COW_VECTOR_H_
@@ -0,0 +1,84 @@
+#ifndef S21_CONTAINERS_SRC_S21_GROWTH_POLICY_H_
+#define S21_CONTAINERS_SRC_S21_GROWTH_POLICY_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace s21 {
+// A growth policy tells a vector which capacity to grow to in one step:
+// next_capacity(capacity, required, element_size) returns a capacity of at
+// least required elements given the current one
+
+// Rounds the byte size of a buffer up to the chunk sizes malloc actually
+// hands out, so the slack the allocator would waste becomes capacity:
+// 16-byte granules for small blocks, whole pages for large ones
+inline size_t RoundToSizeClass(size_t capacity, size_t element_size) noexcept {
+  constexpr size_t kGranule = alignof(std::max_align_t);
+  constexpr size_t kPageSize = 4096;
+
+  if (capacity == 0 || element_size == 0 ||
+      capacity > (SIZE_MAX - kPageSize) / element_size) {
+    return capacity;
+  }
+  size_t bytes = capacity * element_size;
+  size_t unit = bytes < kPageSize ? kGranule : kPageSize;
+  bytes = (bytes + unit - 1) / unit * unit;
+  return bytes / element_size;
+}
+
+// Multiplies the capacity by Numerator / Denominator, starting from
+// InitSize elements
+template <size_t Numerator, size_t Denominator, size_t InitSize = 8>
+struct factor_growth {
+  static_assert(Numerator > Denominator, "growth factor must exceed 1");
+
+  static size_t next_capacity(size_t capacity, size_t required,
+                              size_t element_size) noexcept {
+    size_t grown = InitSize;
+    if (capacity != 0) {
+      grown = capacity / Denominator * Numerator +
+              capacity % Denominator * Numerator / Denominator;
+      if (grown < capacity) {
+        grown = SIZE_MAX / element_size;
+      }
+    }
+    return RoundToSizeClass(std::max(grown, required), element_size);
+  }
+};
+
+// по золотому сечению
+using golden_ratio_growth = factor_growth<1618, 1000>;
+using doubling_growth = factor_growth<2, 1>;
+using one_and_half_growth = factor_growth<3, 2>;
+
+// Grows by a fixed number of elements, which bounds the slack on very large
+// buffers at the cost of more reallocations
+template <size_t Step>
+struct fixed_increment_growth {
+  static_assert(Step > 0, "growth step must be positive");
+
+  static size_t next_capacity(size_t capacity, size_t required,
+                              size_t element_size) noexcept {
+    size_t grown = std::max(capacity + Step, required);
+    grown = (grown + Step - 1) / Step * Step;
+    return RoundToSizeClass(grown, element_size);
+  }
+};
+
+// Applies Policy and rounds the buffer up to whole pages of PageSize bytes
+template <typename Policy = golden_ratio_growth, size_t PageSize = 4096>
+struct page_rounded_growth {
+  static size_t next_capacity(size_t capacity, size_t required,
+                              size_t element_size) noexcept {
+    size_t grown = Policy::next_capacity(capacity, required, element_size);
+    if (element_size == 0 || grown > (SIZE_MAX - PageSize) / element_size) {
+      return grown;
+    }
+    size_t bytes = (grown * element_size + PageSize - 1) / PageSize * PageSize;
+    return bytes / element_size;
+  }
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_GROWTH_POLICY_H_
@@ -111,9 +111,11 @@ class list {
 
   iterator begin() { return iterator(head_ ? head_ : circle_); };
   iterator end() { return iterator(circle_); };
+  const_iterator cbegin() const { return iterator(head_ ? head_ : circle_); };
+  const_iterator cend() const { return iterator(circle_); };
 
-  bool empty() { return head_ == nullptr; };
-  size_type size() { return size_; };
+  bool empty() const { return head_ == nullptr; };
+  size_type size() const { return size_; };
   size_type max_size();
 
   void clear();
@@ -0,0 +1,652 @@
+#ifndef S21_CONTAINERS_SRC_S21_MDARRAY_H_
+#define S21_CONTAINERS_SRC_S21_MDARRAY_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_array.h"
+#include "s21_vector.h"
+
+namespace s21 {
+inline constexpr size_t dynamic_extent = SIZE_MAX;
+
+// The sizes of the dimensions of an mdarray. Each one is either fixed at
+// compile time or dynamic_extent, which is given to the constructor; only
+// the dynamic ones take space
+template <size_t... Extents>
+class extents {
+  static_assert(sizeof...(Extents) > 0, "extents need at least one dimension");
+
+ public:
+  using size_type = size_t;
+  using index_array = array<size_type, sizeof...(Extents)>;
+
+  static constexpr size_type rank() noexcept { return sizeof...(Extents); }
+  static constexpr size_type rank_dynamic() noexcept {
+    return ((Extents == dynamic_extent) + ... + 0);
+  }
+  static constexpr size_type static_extent(size_type r) noexcept {
+    return kStatic[r];
+  }
+
+  constexpr extents() noexcept : dynamic_() {}
+  template <typename... Sizes,
+            typename = std::enable_if_t<
+                sizeof...(Sizes) == rank_dynamic() && sizeof...(Sizes) != 0 &&
+                (std::is_convertible_v<Sizes, size_type> && ...)>>
+  constexpr explicit extents(Sizes... dynamic_sizes) noexcept
+      : dynamic_({static_cast<size_type>(dynamic_sizes)...}) {}
+
+  constexpr size_type extent(size_type r) const noexcept;
+  constexpr size_type size() const noexcept;
+  constexpr index_array as_array() const noexcept;
+
+ private:
+  static constexpr index_array kStatic = {Extents...};
+  // Position of each dynamic extent among the stored ones
+  static constexpr index_array kDynamicIndex = [] {
+    index_array result{};
+    size_type index = 0;
+    for (size_type r = 0; r < sizeof...(Extents); ++r) {
+      result[r] = index;
+      index += kStatic[r] == dynamic_extent;
+    }
+    return result;
+  }();
+
+  array<size_type, rank_dynamic()> dynamic_;
+};
+
+template <size_t... Extents>
+constexpr typename extents<Extents...>::size_type extents<Extents...>::extent(
+    size_type r) const noexcept {
+  if (kStatic[r] != dynamic_extent) {
+    return kStatic[r];
+  }
+  return dynamic_[kDynamicIndex[r]];
+}
+
+template <size_t... Extents>
+constexpr typename extents<Extents...>::size_type extents<Extents...>::size()
+    const noexcept {
+  size_type result = 1;
+  for (size_type r = 0; r < rank(); ++r) {
+    result *= extent(r);
+  }
+  return result;
+}
+
+template <size_t... Extents>
+constexpr typename extents<Extents...>::index_array
+extents<Extents...>::as_array() const noexcept {
+  index_array result{};
+  for (size_type r = 0; r < rank(); ++r) {
+    result[r] = extent(r);
+  }
+  return result;
+}
+
+// A layout maps an index tuple to an offset in the buffer of an mdarray:
+// span_size(sizes) is the buffer size and offset(extents, indices) the
+// place of an element. Strided layouts also give the step of each index
+// through strides(sizes)
+
+// Row-major: the last index is contiguous, like nested C arrays
+struct layout_right {
+  static constexpr bool is_strided = true;
+
+  template <size_t Rank>
+  static constexpr size_t span_size(const array<size_t, Rank> &e) noexcept {
+    size_t result = 1;
+    for (size_t r = 0; r < Rank; ++r) {
+      result *= e[r];
+    }
+    return result;
+  }
+
+  template <typename Extents>
+  static constexpr size_t offset(
+      const Extents &e, const typename Extents::index_array &index) noexcept {
+    size_t result = 0;
+    for (size_t r = 0; r < Extents::rank(); ++r) {
+      result = result * e.extent(r) + index[r];
+    }
+    return result;
+  }
+
+  template <size_t Rank>
+  static constexpr array<size_t, Rank> strides(
+      const array<size_t, Rank> &e) noexcept {
+    array<size_t, Rank> result{};
+    size_t stride = 1;
+    for (size_t r = Rank; r-- > 0;) {
+      result[r] = stride;
+      stride *= e[r];
+    }
+    return result;
+  }
+};
+
+// Column-major: the first index is contiguous, like Fortran and BLAS
+struct layout_left {
+  static constexpr bool is_strided = true;
+
+  template <size_t Rank>
+  static constexpr size_t span_size(const array<size_t, Rank> &e) noexcept {
+    return layout_right::span_size(e);
+  }
+
+  template <typename Extents>
+  static constexpr size_t offset(
+      const Extents &e, const typename Extents::index_array &index) noexcept {
+    size_t result = 0;
+    for (size_t r = Extents::rank(); r-- > 0;) {
+      result = result * e.extent(r) + index[r];
+    }
+    return result;
+  }
+
+  template <size_t Rank>
+  static constexpr array<size_t, Rank> strides(
+      const array<size_t, Rank> &e) noexcept {
+    array<size_t, Rank> result{};
+    size_t stride = 1;
+    for (size_t r = 0; r < Rank; ++r) {
+      result[r] = stride;
+      stride *= e[r];
+    }
+    return result;
+  }
+};
+
+// Matrices stored as TileRows x TileCols tiles, each one row-major and
+// contiguous, with the tiles themselves in row-major order. A kernel that
+// works tile by tile streams through memory. Edge tiles are padded to full
+// size, so the buffer may be larger than the matrix
+template <size_t TileRows, size_t TileCols = TileRows>
+struct layout_tiled {
+  static_assert(TileRows > 0 && TileCols > 0, "tiles can't be empty");
+
+  static constexpr bool is_strided = false;
+  static constexpr size_t tile_rows = TileRows;
+  static constexpr size_t tile_cols = TileCols;
+
+  static constexpr size_t span_size(const array<size_t, 2> &e) noexcept {
+    return TileCount(e[0], TileRows) * TileRows * TileCount(e[1], TileCols) *
+           TileCols;
+  }
+
+  template <typename Extents>
+  static constexpr size_t offset(
+      const Extents &e, const typename Extents::index_array &index) noexcept {
+    size_t tile = index[0] / TileRows * TileCount(e.extent(1), TileCols) +
+                  index[1] / TileCols;
+    return tile * TileRows * TileCols + index[0] % TileRows * TileCols +
+           index[1] % TileCols;
+  }
+
+  static constexpr size_t TileCount(size_t extent, size_t tile) noexcept {
+    return extent / tile + (extent % tile != 0);
+  }
+};
+
+// A non-owning view of a Rank-dimensional block of elements, each index
+// moving through memory by its own stride. Views of an mdarray can be
+// narrowed, strided, reduced by fixing the first index and, for matrices,
+// transposed without copying anything. Indices aren't checked
+template <typename T, size_t Rank>
+class strided_view {
+  static_assert(Rank > 0, "a view needs at least one dimension");
+
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using size_type = size_t;
+  using index_array = array<size_type, Rank>;
+
+  constexpr strided_view() noexcept : data_(nullptr), extents_(), strides_() {}
+  constexpr strided_view(T *data, const index_array &extents,
+                         const index_array &strides) noexcept
+      : data_(data), extents_(extents), strides_(strides) {}
+  template <typename U, typename = std::enable_if_t<
+                            std::is_convertible_v<U (*)[], T (*)[]>>>
+  constexpr strided_view(const strided_view<U, Rank> &other) noexcept
+      : data_(other.data_),
+        extents_(other.extents_),
+        strides_(other.strides_) {}
+
+  static constexpr size_type rank() noexcept { return Rank; }
+  constexpr size_type extent(size_type r) const noexcept;
+  constexpr size_type stride(size_type r) const noexcept;
+  constexpr size_type size() const noexcept;
+  constexpr bool empty() const noexcept;
+  constexpr T *data() const noexcept;
+
+  template <typename... Indices>
+  constexpr reference operator()(Indices... indices) const noexcept;
+
+  // count elements of dimension dim, from first on, every step-th one
+  constexpr strided_view slice(size_type dim, size_type first, size_type count,
+                               size_type step = 1) const noexcept;
+  // The view one dimension lower with the first index fixed
+  constexpr strided_view<T, Rank - 1> operator[](
+      size_type index) const noexcept;
+  // The same matrix with rows and columns swapped
+  constexpr strided_view transposed() const noexcept;
+
+ private:
+  template <typename, size_t>
+  friend class strided_view;
+
+  T *data_;
+  index_array extents_;
+  index_array strides_;
+};
+
+template <typename T, size_t Rank>
+constexpr typename strided_view<T, Rank>::size_type
+strided_view<T, Rank>::extent(size_type r) const noexcept {
+  return extents_[r];
+}
+
+template <typename T, size_t Rank>
+constexpr typename strided_view<T, Rank>::size_type
+strided_view<T, Rank>::stride(size_type r) const noexcept {
+  return strides_[r];
+}
+
+template <typename T, size_t Rank>
+constexpr typename strided_view<T, Rank>::size_type
+strided_view<T, Rank>::size() const noexcept {
+  return layout_right::span_size(extents_);
+}
+
+template <typename T, size_t Rank>
+constexpr bool strided_view<T, Rank>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <typename T, size_t Rank>
+constexpr T *strided_view<T, Rank>::data() const noexcept {
+  return data_;
+}
+
+template <typename T, size_t Rank>
+template <typename... Indices>
+constexpr typename strided_view<T, Rank>::reference
+strided_view<T, Rank>::operator()(Indices... indices) const noexcept {
+  static_assert(sizeof...(Indices) == Rank, "one index per dimension");
+  index_array index = {static_cast<size_type>(indices)...};
+  size_type offset = 0;
+  for (size_type r = 0; r < Rank; ++r) {
+    offset += index[r] * strides_[r];
+  }
+  return data_[offset];
+}
+
+template <typename T, size_t Rank>
+constexpr strided_view<T, Rank> strided_view<T, Rank>::slice(
+    size_type dim, size_type first, size_type count,
+    size_type step) const noexcept {
+  strided_view result = *this;
+  result.data_ += first * strides_[dim];
+  result.extents_[dim] = count;
+  result.strides_[dim] *= step;
+  return result;
+}
+
+template <typename T, size_t Rank>
+constexpr strided_view<T, Rank - 1> strided_view<T, Rank>::operator[](
+    size_type index) const noexcept {
+  static_assert(Rank > 1, "a single dimension can't be reduced");
+  strided_view<T, Rank - 1> result;
+  result.data_ = data_ + index * strides_[0];
+  for (size_type r = 1; r < Rank; ++r) {
+    result.extents_[r - 1] = extents_[r];
+    result.strides_[r - 1] = strides_[r];
+  }
+  return result;
+}
+
+template <typename T, size_t Rank>
+constexpr strided_view<T, Rank> strided_view<T, Rank>::transposed()
+    const noexcept {
+  static_assert(Rank == 2, "only matrices can be transposed");
+  strided_view result = *this;
+  std::swap(result.extents_[0], result.extents_[1]);
+  std::swap(result.strides_[0], result.strides_[1]);
+  return result;
+}
+
+// A multi-dimensional array in one contiguous buffer: an s21::array when
+// every extent is static, an s21::vector otherwise. Layout decides the
+// order of the elements in it. Elements are value-initialized
+template <typename T, typename Extents, typename Layout = layout_right>
+class basic_mdarray {
+  static constexpr size_t kRank = Extents::rank();
+  static constexpr bool kStatic = Extents::rank_dynamic() == 0;
+
+  static_assert(Layout::is_strided || kRank == 2,
+                "tiled layouts are for matrices only");
+
+  static constexpr size_t StaticSpan() noexcept {
+    if constexpr (kStatic) {
+      return Layout::span_size(Extents().as_array());
+    } else {
+      return 0;
+    }
+  }
+
+  using storage_type =
+      std::conditional_t<kStatic, array<T, StaticSpan()>, vector<T>>;
+
+ public:
+  using extents_type = Extents;
+  using layout_type = Layout;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using view_type = strided_view<T, kRank>;
+  using const_view_type = strided_view<const T, kRank>;
+
+  basic_mdarray();
+  template <typename... Sizes,
+            typename = std::enable_if_t<
+                sizeof...(Sizes) == Extents::rank_dynamic() &&
+                sizeof...(Sizes) != 0 &&
+                (std::is_convertible_v<Sizes, size_type> && ...)>>
+  explicit basic_mdarray(Sizes... dynamic_sizes);
+  explicit basic_mdarray(const extents_type &shape);
+
+  static constexpr size_type rank() noexcept { return kRank; }
+  const extents_type &extents() const noexcept;
+  size_type extent(size_type r) const noexcept;
+  size_type size() const noexcept;
+  bool empty() const noexcept;
+  // The buffer, padded for tiled layouts
+  T *data() noexcept;
+  const T *data() const noexcept;
+
+  template <typename... Indices>
+  reference operator()(Indices... indices) noexcept;
+  template <typename... Indices>
+  const_reference operator()(Indices... indices) const noexcept;
+  template <typename... Indices>
+  reference at(Indices... indices);
+  template <typename... Indices>
+  const_reference at(Indices... indices) const;
+
+  void fill(const_reference value);
+  void swap(basic_mdarray &other);
+
+  // The whole array as a strided view, for strided layouts
+  view_type view() noexcept;
+  const_view_type view() const noexcept;
+  // One row-major tile of a tiled matrix, edge tiles are cut to the matrix
+  view_type tile(size_type row, size_type col) noexcept;
+  const_view_type tile(size_type row, size_type col) const noexcept;
+
+ private:
+  Extents extents_;
+  storage_type storage_;
+
+  static storage_type MakeStorage(const Extents &shape);
+  template <typename... Indices>
+  size_type Offset(Indices... indices) const noexcept;
+  template <typename... Indices>
+  void CheckIndices(Indices... indices) const;
+  const_view_type TileView(size_type row, size_type col) const noexcept;
+};
+
+template <typename T, size_t... Extents>
+using mdarray = basic_mdarray<T, extents<Extents...>, layout_right>;
+
+template <typename T, typename Extents, typename Layout>
+basic_mdarray<T, Extents, Layout>::basic_mdarray()
+    : extents_(), storage_(MakeStorage(extents_)) {}
+
+template <typename T, typename Extents, typename Layout>
+template <typename... Sizes, typename>
+basic_mdarray<T, Extents, Layout>::basic_mdarray(Sizes... dynamic_sizes)
+    : extents_(dynamic_sizes...), storage_(MakeStorage(extents_)) {}
+
+template <typename T, typename Extents, typename Layout>
+basic_mdarray<T, Extents, Layout>::basic_mdarray(const extents_type &shape)
+    : extents_(shape), storage_(MakeStorage(extents_)) {}
+
+template <typename T, typename Extents, typename Layout>
+const typename basic_mdarray<T, Extents, Layout>::extents_type &
+basic_mdarray<T, Extents, Layout>::extents() const noexcept {
+  return extents_;
+}
+
+template <typename T, typename Extents, typename Layout>
+typename basic_mdarray<T, Extents, Layout>::size_type
+basic_mdarray<T, Extents, Layout>::extent(size_type r) const noexcept {
+  return extents_.extent(r);
+}
+
+template <typename T, typename Extents, typename Layout>
+typename basic_mdarray<T, Extents, Layout>::size_type
+basic_mdarray<T, Extents, Layout>::size() const noexcept {
+  return extents_.size();
+}
+
+template <typename T, typename Extents, typename Layout>
+bool basic_mdarray<T, Extents, Layout>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <typename T, typename Extents, typename Layout>
+T *basic_mdarray<T, Extents, Layout>::data() noexcept {
+  return storage_.begin();
+}
+
+template <typename T, typename Extents, typename Layout>
+const T *basic_mdarray<T, Extents, Layout>::data() const noexcept {
+  if constexpr (kStatic) {
+    return storage_.begin();
+  } else {
+    return storage_.cbegin();
+  }
+}
+
+template <typename T, typename Extents, typename Layout>
+template <typename... Indices>
+typename basic_mdarray<T, Extents, Layout>::reference
+basic_mdarray<T, Extents, Layout>::operator()(Indices... indices) noexcept {
+  return data()[Offset(indices...)];
+}
+
+template <typename T, typename Extents, typename Layout>
+template <typename... Indices>
+typename basic_mdarray<T, Extents, Layout>::const_reference
+basic_mdarray<T, Extents, Layout>::operator()(
+    Indices... indices) const noexcept {
+  return data()[Offset(indices...)];
+}
+
+template <typename T, typename Extents, typename Layout>
+template <typename... Indices>
+typename basic_mdarray<T, Extents, Layout>::reference
+basic_mdarray<T, Extents, Layout>::at(Indices... indices) {
+  CheckIndices(indices...);
+  return (*this)(indices...);
+}
+
+template <typename T, typename Extents, typename Layout>
+template <typename... Indices>
+typename basic_mdarray<T, Extents, Layout>::const_reference
+basic_mdarray<T, Extents, Layout>::at(Indices... indices) const {
+  CheckIndices(indices...);
+  return (*this)(indices...);
+}
+
+// Padding of tiled layouts is filled as well
+template <typename T, typename Extents, typename Layout>
+void basic_mdarray<T, Extents, Layout>::fill(const_reference value) {
+  if constexpr (kStatic) {
+    storage_.fill(value);
+  } else {
+    std::fill(storage_.begin(), storage_.end(), value);
+  }
+}
+
+template <typename T, typename Extents, typename Layout>
+void basic_mdarray<T, Extents, Layout>::swap(basic_mdarray &other) {
+  std::swap(extents_, other.extents_);
+  storage_.swap(other.storage_);
+}
+
+template <typename T, typename Extents, typename Layout>
+typename basic_mdarray<T, Extents, Layout>::view_type
+basic_mdarray<T, Extents, Layout>::view() noexcept {
+  static_assert(Layout::is_strided, "tiled arrays have no strided view");
+  auto shape = extents_.as_array();
+  return view_type(data(), shape, Layout::strides(shape));
+}
+
+template <typename T, typename Extents, typename Layout>
+typename basic_mdarray<T, Extents, Layout>::const_view_type
+basic_mdarray<T, Extents, Layout>::view() const noexcept {
+  static_assert(Layout::is_strided, "tiled arrays have no strided view");
+  auto shape = extents_.as_array();
+  return const_view_type(data(), shape, Layout::strides(shape));
+}
+
+template <typename T, typename Extents, typename Layout>
+typename basic_mdarray<T, Extents, Layout>::view_type
+basic_mdarray<T, Extents, Layout>::tile(size_type row,
+                                        size_type col) noexcept {
+  const_view_type tile = TileView(row, col);
+  return view_type(data() + (tile.data() - std::as_const(*this).data()),
+                   {tile.extent(0), tile.extent(1)},
+                   {tile.stride(0), tile.stride(1)});
+}
+
+template <typename T, typename Extents, typename Layout>
+typename basic_mdarray<T, Extents, Layout>::const_view_type
+basic_mdarray<T, Extents, Layout>::tile(size_type row,
+                                        size_type col) const noexcept {
+  return TileView(row, col);
+}
+
+template <typename T, typename Extents, typename Layout>
+typename basic_mdarray<T, Extents, Layout>::storage_type
+basic_mdarray<T, Extents, Layout>::MakeStorage(const Extents &shape) {
+  if constexpr (kStatic) {
+    return storage_type{};
+  } else {
+    return storage_type(Layout::span_size(shape.as_array()));
+  }
+}
+
+template <typename T, typename Extents, typename Layout>
+template <typename... Indices>
+typename basic_mdarray<T, Extents, Layout>::size_type
+basic_mdarray<T, Extents, Layout>::Offset(Indices... indices) const noexcept {
+  static_assert(sizeof...(Indices) == kRank, "one index per dimension");
+  return Layout::offset(extents_, typename Extents::index_array{
+                                      static_cast<size_type>(indices)...});
+}
+
+template <typename T, typename Extents, typename Layout>
+template <typename... Indices>
+void basic_mdarray<T, Extents, Layout>::CheckIndices(
+    Indices... indices) const {
+  static_assert(sizeof...(Indices) == kRank, "one index per dimension");
+  array<size_type, kRank> index = {static_cast<size_type>(indices)...};
+  for (size_type r = 0; r < kRank; ++r) {
+    if (index[r] >= extent(r)) {
+      throw std::out_of_range("mdarray index out of range");
+    }
+  }
+}
+
+template <typename T, typename Extents, typename Layout>
+typename basic_mdarray<T, Extents, Layout>::const_view_type
+basic_mdarray<T, Extents, Layout>::TileView(size_type row,
+                                            size_type col) const noexcept {
+  static_assert(!Layout::is_strided, "only tiled arrays have tiles");
+  constexpr size_type kRows = Layout::tile_rows;
+  constexpr size_type kCols = Layout::tile_cols;
+  size_type first_row = row * kRows;
+  size_type first_col = col * kCols;
+  return const_view_type(
+      data() + Offset(first_row, first_col),
+      {std::min(kRows, extent(0) - first_row),
+       std::min(kCols, extent(1) - first_col)},
+      {kCols, 1});
+}
+
+namespace detail {
+// Side of the square blocks matrix copies go through: two blocks of
+// doubles take 16 KiB and stay in L1 while both are walked
+inline constexpr size_t kMatrixBlock = 32;
+
+template <typename T, typename U, size_t Rank>
+void CheckSameExtents(const strided_view<T, Rank> &src,
+                      const strided_view<U, Rank> &dst) {
+  for (size_t r = 0; r < Rank; ++r) {
+    if (src.extent(r) != dst.extent(r)) {
+      throw std::invalid_argument("views have different extents");
+    }
+  }
+}
+
+template <typename T, typename U>
+void CopyMatrixBlocked(const strided_view<T, 2> &src,
+                       const strided_view<U, 2> &dst) noexcept {
+  size_t rows = src.extent(0);
+  size_t cols = src.extent(1);
+  size_t src_row = src.stride(0), src_col = src.stride(1);
+  size_t dst_row = dst.stride(0), dst_col = dst.stride(1);
+  for (size_t i0 = 0; i0 < rows; i0 += kMatrixBlock) {
+    size_t i1 = std::min(i0 + kMatrixBlock, rows);
+    for (size_t j0 = 0; j0 < cols; j0 += kMatrixBlock) {
+      size_t j1 = std::min(j0 + kMatrixBlock, cols);
+      for (size_t i = i0; i < i1; ++i) {
+        const T *from = src.data() + i * src_row;
+        U *to = dst.data() + i * dst_row;
+        for (size_t j = j0; j < j1; ++j) {
+          to[j * dst_col] = from[j * src_col];
+        }
+      }
+    }
+  }
+}
+}  // namespace detail
+
+// Copies src into dst, which must have the same extents and must not
+// overlap it. Matrices are copied in square blocks, so copies between
+// row-major and column-major views use every cache line they load
+template <typename T, typename U, size_t Rank>
+void copy(const strided_view<T, Rank> &src, const strided_view<U, Rank> &dst) {
+  detail::CheckSameExtents(src, dst);
+  if constexpr (Rank == 1) {
+    for (size_t i = 0; i < src.extent(0); ++i) {
+      dst(i) = src(i);
+    }
+  } else if constexpr (Rank == 2) {
+    detail::CopyMatrixBlocked(src, dst);
+  } else {
+    for (size_t i = 0; i < src.extent(0); ++i) {
+      copy(src[i], dst[i]);
+    }
+  }
+}
+
+// Writes the transpose of the src matrix into dst, which must not overlap it
+template <typename T, typename U>
+void transpose(const strided_view<T, 2> &src, const strided_view<U, 2> &dst) {
+  copy(src.transposed(), dst);
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_MDARRAY_H_
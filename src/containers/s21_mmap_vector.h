@@ -0,0 +1,597 @@
+#ifndef S21_CONTAINERS_SRC_S21_MMAP_VECTOR_H_
+#define S21_CONTAINERS_SRC_S21_MMAP_VECTOR_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "s21_growth_policy.h"
+
+namespace s21 {
+// A vector of trivially copyable elements that lives in a memory-mapped
+// file. The file starts with a 64-byte header holding the element size and
+// the current size, followed by the elements, so opening an existing file
+// is a single mmap and the pages are shared with every other process that
+// maps it. Growing extends the file with ftruncate and the mapping with
+// mremap, which moves no data. Changes reach the file through the page
+// cache; sync() waits until they are on disk
+template <typename T, typename GrowthPolicy = page_rounded_growth<>>
+class mmap_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mmap_vector elements must be trivially copyable");
+  static_assert(alignof(T) <= 64, "mmap_vector elements must fit the header");
+
+ public:
+  // Mmap vector Member Type
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  // Mmap vector Member functions
+  // Opens path, or creates an empty vector there when the file is missing
+  // or empty. Throws std::invalid_argument when the file holds something
+  // else or elements of another size
+  explicit mmap_vector(const std::string &path);
+  mmap_vector(const mmap_vector &v) = delete;
+  mmap_vector(mmap_vector &&v) noexcept;
+  ~mmap_vector();
+
+  mmap_vector &operator=(const mmap_vector &v) = delete;
+  mmap_vector &operator=(mmap_vector &&v) noexcept;
+
+  // Mmap vector Element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) noexcept;
+  const_reference operator[](size_type pos) const noexcept;
+  const_reference front() const noexcept;
+  const_reference back() const noexcept;
+  T *data() noexcept;
+  const T *data() const noexcept;
+
+  // Mmap vector iterators
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Mmap vector capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+  size_type capacity() const noexcept;
+  void shrink_to_fit();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
+
+  // Mmap vector modifiers
+  void clear() noexcept;
+  iterator insert(const_iterator pos, const_reference value);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  void push_back(const_reference value);
+  void pop_back() noexcept;
+  void swap(mmap_vector &other) noexcept;
+  void append(const value_type *arr, size_type count);
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+  // Mmap vector file
+  void sync();
+  const std::string &path() const noexcept;
+
+ private:
+  struct Header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t element_size;
+    uint64_t size;
+  };
+
+  static constexpr uint64_t kMagic = 0x5254434556313253;  // "S21VECTR"
+  static constexpr uint32_t kVersion = 1;
+  static constexpr size_t kHeaderSize = 64;
+
+  std::string path_;
+  int fd_;
+  char *mapping_;
+  size_t capacity_;
+
+  Header *header() const noexcept;
+  value_type *arr() const noexcept;
+  void ExpandArray(size_type required);
+  void Remap(size_type capacity);
+  void Close() noexcept;
+  size_type InsertGap(size_type index, size_type count);
+
+  static size_t BytesFor(size_type capacity) noexcept;
+  [[noreturn]] static void ThrowErrno(const char *what);
+};
+
+// Mmap vector Member functions
+template <typename T, typename GrowthPolicy>
+mmap_vector<T, GrowthPolicy>::mmap_vector(const std::string &path)
+    : path_(path), fd_(-1), mapping_(nullptr), capacity_(0) {
+  fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (fd_ < 0) {
+    ThrowErrno("mmap_vector: open");
+  }
+  try {
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) {
+      ThrowErrno("mmap_vector: fstat");
+    }
+    size_t bytes = static_cast<size_t>(st.st_size);
+    bool created = bytes == 0;
+    if (created) {
+      bytes = kHeaderSize;
+      if (::ftruncate(fd_, bytes) != 0) {
+        ThrowErrno("mmap_vector: ftruncate");
+      }
+    } else if (bytes < kHeaderSize) {
+      throw std::invalid_argument("mmap_vector: not an mmap_vector file");
+    }
+
+    void *mapping =
+        ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) {
+      ThrowErrno("mmap_vector: mmap");
+    }
+    mapping_ = static_cast<char *>(mapping);
+    capacity_ = (bytes - kHeaderSize) / sizeof(value_type);
+
+    if (created) {
+      *header() = Header{kMagic, kVersion, sizeof(value_type), 0};
+    } else if (header()->magic != kMagic || header()->version != kVersion) {
+      throw std::invalid_argument("mmap_vector: not an mmap_vector file");
+    } else if (header()->element_size != sizeof(value_type)) {
+      throw std::invalid_argument("mmap_vector: element size mismatch");
+    } else if (header()->size > capacity_) {
+      throw std::invalid_argument("mmap_vector: file is truncated");
+    }
+  } catch (...) {
+    Close();
+    throw;
+  }
+}
+
+template <typename T, typename GrowthPolicy>
+mmap_vector<T, GrowthPolicy>::mmap_vector(mmap_vector &&v) noexcept
+    : path_(std::move(v.path_)),
+      fd_(v.fd_),
+      mapping_(v.mapping_),
+      capacity_(v.capacity_) {
+  v.fd_ = -1;
+  v.mapping_ = nullptr;
+  v.capacity_ = 0;
+}
+
+template <typename T, typename GrowthPolicy>
+mmap_vector<T, GrowthPolicy>::~mmap_vector() {
+  Close();
+}
+
+template <typename T, typename GrowthPolicy>
+mmap_vector<T, GrowthPolicy> &mmap_vector<T, GrowthPolicy>::operator=(
+    mmap_vector &&v) noexcept {
+  if (this != &v) {
+    Close();
+    path_ = std::move(v.path_);
+    fd_ = std::exchange(v.fd_, -1);
+    mapping_ = std::exchange(v.mapping_, nullptr);
+    capacity_ = std::exchange(v.capacity_, 0);
+  }
+  return *this;
+}
+
+// Mmap vector Element access
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::reference
+mmap_vector<T, GrowthPolicy>::at(size_type pos) {
+  if (pos >= size()) {
+    throw std::out_of_range("accessing mmap_vector element out of range");
+  }
+  return arr()[pos];
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::const_reference
+mmap_vector<T, GrowthPolicy>::at(size_type pos) const {
+  if (pos >= size()) {
+    throw std::out_of_range("accessing mmap_vector element out of range");
+  }
+  return arr()[pos];
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::reference
+mmap_vector<T, GrowthPolicy>::operator[](size_type pos) noexcept {
+  return arr()[pos];
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::const_reference
+mmap_vector<T, GrowthPolicy>::operator[](size_type pos) const noexcept {
+  return arr()[pos];
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::const_reference
+mmap_vector<T, GrowthPolicy>::front() const noexcept {
+  return arr()[0];
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::const_reference
+mmap_vector<T, GrowthPolicy>::back() const noexcept {
+  return arr()[size() - 1];
+}
+
+template <typename T, typename GrowthPolicy>
+T *mmap_vector<T, GrowthPolicy>::data() noexcept {
+  return arr();
+}
+
+template <typename T, typename GrowthPolicy>
+const T *mmap_vector<T, GrowthPolicy>::data() const noexcept {
+  return arr();
+}
+
+// Mmap vector iterators
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::iterator
+mmap_vector<T, GrowthPolicy>::begin() noexcept {
+  return arr();
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::const_iterator
+mmap_vector<T, GrowthPolicy>::begin() const noexcept {
+  return arr();
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::const_iterator
+mmap_vector<T, GrowthPolicy>::cbegin() const noexcept {
+  return arr();
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::iterator
+mmap_vector<T, GrowthPolicy>::end() noexcept {
+  return arr() + size();
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::const_iterator
+mmap_vector<T, GrowthPolicy>::end() const noexcept {
+  return arr() + size();
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::const_iterator
+mmap_vector<T, GrowthPolicy>::cend() const noexcept {
+  return arr() + size();
+}
+
+// Mmap vector capacity
+template <typename T, typename GrowthPolicy>
+bool mmap_vector<T, GrowthPolicy>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::size_type
+mmap_vector<T, GrowthPolicy>::size() const noexcept {
+  return mapping_ == nullptr ? 0 : header()->size;
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::size_type
+mmap_vector<T, GrowthPolicy>::max_size() const noexcept {
+  return (PTRDIFF_MAX - kHeaderSize) / sizeof(value_type);
+}
+
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("mmap_vector size exceeds max_size");
+  }
+  if (size > capacity_) {
+    Remap(size);
+  }
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::size_type
+mmap_vector<T, GrowthPolicy>::capacity() const noexcept {
+  return capacity_;
+}
+
+// Truncates the file to the elements in use
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::shrink_to_fit() {
+  if (capacity_ > size()) {
+    Remap(size());
+  }
+}
+
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::resize(size_type count) {
+  resize(count, value_type());
+}
+
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::resize(size_type count,
+                                          const_reference value) {
+  value_type copy = value;
+  if (count > capacity_) {
+    ExpandArray(count);
+  }
+  for (size_type i = size(); i < count; ++i) {
+    arr()[i] = copy;
+  }
+  header()->size = count;
+}
+
+// Mmap vector modifiers
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::clear() noexcept {
+  if (mapping_ != nullptr) {
+    header()->size = 0;
+  }
+}
+
+// value is copied first, since growing may remap the element it refers to
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::iterator
+mmap_vector<T, GrowthPolicy>::insert(const_iterator pos,
+                                     const_reference value) {
+  value_type copy = value;
+  size_type index = InsertGap(pos - cbegin(), 1);
+  arr()[index] = copy;
+  return arr() + index;
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::iterator
+mmap_vector<T, GrowthPolicy>::erase(const_iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::iterator
+mmap_vector<T, GrowthPolicy>::erase(const_iterator first,
+                                    const_iterator last) {
+  size_type index = first - cbegin();
+  size_type count = last - first;
+  std::memmove(static_cast<void *>(arr() + index),
+               static_cast<const void *>(arr() + index + count),
+               (size() - index - count) * sizeof(value_type));
+  header()->size -= count;
+  return arr() + index;
+}
+
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::pop_back() noexcept {
+  --header()->size;
+}
+
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::swap(mmap_vector &other) noexcept {
+  std::swap(path_, other.path_);
+  std::swap(fd_, other.fd_);
+  std::swap(mapping_, other.mapping_);
+  std::swap(capacity_, other.capacity_);
+}
+
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::append(const value_type *arr,
+                                          size_type count) {
+  if (count == 0) {
+    return;
+  }
+  size_type old_size = size();
+  if (count > max_size() - old_size) {
+    throw std::length_error("mmap_vector size exceeds max_size");
+  }
+  // arr may point into this vector, so it is resolved before remapping
+  const char *source = reinterpret_cast<const char *>(arr);
+  const char *first = reinterpret_cast<const char *>(this->arr());
+  bool inside = mapping_ != nullptr && source >= first &&
+                source < first + old_size * sizeof(value_type);
+  size_type offset = inside ? static_cast<size_type>(arr - this->arr()) : 0;
+  if (old_size + count > capacity_) {
+    ExpandArray(old_size + count);
+  }
+  if (inside) {
+    arr = this->arr() + offset;
+  }
+  std::memcpy(static_cast<void *>(this->arr() + old_size),
+              static_cast<const void *>(arr), count * sizeof(value_type));
+  header()->size = old_size + count;
+}
+
+template <typename T, typename GrowthPolicy>
+template <typename... Args>
+typename mmap_vector<T, GrowthPolicy>::reference
+mmap_vector<T, GrowthPolicy>::emplace_back(Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  size_type index = size();
+  if (index == capacity_) {
+    ExpandArray(index + 1);
+  }
+  arr()[index] = value;
+  header()->size = index + 1;
+  return arr()[index];
+}
+
+template <typename T, typename GrowthPolicy>
+template <typename... Args>
+typename mmap_vector<T, GrowthPolicy>::iterator
+mmap_vector<T, GrowthPolicy>::insert_many(const_iterator pos,
+                                          Args &&...args) {
+  size_type index = pos - cbegin();
+  if constexpr (sizeof...(Args) == 0) {
+    return begin() + index;
+  } else {
+    value_type items[] = {value_type(std::forward<Args>(args))...};
+    InsertGap(index, sizeof...(Args));
+    std::memcpy(static_cast<void *>(arr() + index),
+                static_cast<const void *>(items), sizeof(items));
+    return arr() + index;
+  }
+}
+
+template <typename T, typename GrowthPolicy>
+template <typename... Args>
+void mmap_vector<T, GrowthPolicy>::insert_many_back(Args &&...args) {
+  insert_many(cend(), std::forward<Args>(args)...);
+}
+
+// Mmap vector file
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::sync() {
+  if (mapping_ != nullptr &&
+      ::msync(mapping_, BytesFor(capacity_), MS_SYNC) != 0) {
+    ThrowErrno("mmap_vector: msync");
+  }
+}
+
+template <typename T, typename GrowthPolicy>
+const std::string &mmap_vector<T, GrowthPolicy>::path() const noexcept {
+  return path_;
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::Header *
+mmap_vector<T, GrowthPolicy>::header() const noexcept {
+  return reinterpret_cast<Header *>(mapping_);
+}
+
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::value_type *
+mmap_vector<T, GrowthPolicy>::arr() const noexcept {
+  return mapping_ == nullptr
+             ? nullptr
+             : reinterpret_cast<value_type *>(mapping_ + kHeaderSize);
+}
+
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::ExpandArray(size_type required) {
+  if (required > max_size()) {
+    throw std::length_error("mmap_vector size exceeds max_size");
+  }
+  size_type capacity =
+      GrowthPolicy::next_capacity(capacity_, required, sizeof(value_type));
+  Remap(std::min(std::max(capacity, required), max_size()));
+}
+
+// The file is extended before the mapping and truncated after it, so no
+// mapped page is ever past the end of the file
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::Remap(size_type capacity) {
+  size_t old_bytes = BytesFor(capacity_);
+  size_t new_bytes = BytesFor(capacity);
+  if (new_bytes > old_bytes &&
+      ::ftruncate(fd_, static_cast<off_t>(new_bytes)) != 0) {
+    ThrowErrno("mmap_vector: ftruncate");
+  }
+#ifdef __linux__
+  void *mapping = ::mremap(mapping_, old_bytes, new_bytes, MREMAP_MAYMOVE);
+#else
+  void *mapping = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE,
+                         MAP_SHARED, fd_, 0);
+#endif
+  if (mapping == MAP_FAILED) {
+    int error = errno;
+    if (new_bytes > old_bytes) {
+      static_cast<void>(::ftruncate(fd_, static_cast<off_t>(old_bytes)));
+    }
+    errno = error;
+    ThrowErrno("mmap_vector: mremap");
+  }
+#ifndef __linux__
+  ::munmap(mapping_, old_bytes);
+#endif
+  mapping_ = static_cast<char *>(mapping);
+  capacity_ = capacity;
+  if (new_bytes < old_bytes) {
+    static_cast<void>(::ftruncate(fd_, static_cast<off_t>(new_bytes)));
+  }
+}
+
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::Close() noexcept {
+  if (mapping_ != nullptr) {
+    ::munmap(mapping_, BytesFor(capacity_));
+    mapping_ = nullptr;
+  }
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  capacity_ = 0;
+}
+
+// Opens count slots at index, growing the file if needed
+template <typename T, typename GrowthPolicy>
+typename mmap_vector<T, GrowthPolicy>::size_type
+mmap_vector<T, GrowthPolicy>::InsertGap(size_type index, size_type count) {
+  size_type old_size = size();
+  if (count > max_size() - old_size) {
+    throw std::length_error("mmap_vector size exceeds max_size");
+  }
+  if (old_size + count > capacity_) {
+    ExpandArray(old_size + count);
+  }
+  std::memmove(static_cast<void *>(arr() + index + count),
+               static_cast<const void *>(arr() + index),
+               (old_size - index) * sizeof(value_type));
+  header()->size = old_size + count;
+  return index;
+}
+
+template <typename T, typename GrowthPolicy>
+size_t mmap_vector<T, GrowthPolicy>::BytesFor(size_type capacity) noexcept {
+  return kHeaderSize + capacity * sizeof(value_type);
+}
+
+template <typename T, typename GrowthPolicy>
+void mmap_vector<T, GrowthPolicy>::ThrowErrno(const char *what) {
+  throw std::system_error(errno, std::generic_category(), what);
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_MMAP_VECTOR_H_
@@ -0,0 +1,736 @@
+#ifndef S21_CONTAINERS_SRC_S21_SEGMENTED_VECTOR_H_
+#define S21_CONTAINERS_SRC_S21_SEGMENTED_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// A vector whose elements never move once constructed: storage is a list of
+// segments of 8, 16, 32, ... elements, so growing adds a segment instead of
+// reallocating and pointers to elements stay valid until they are erased.
+// Element i lives in segment log2(i / 8 + 1), which keeps random access
+// O(1). Only insert, emplace and erase before the end shift elements.
+// The segment table has its own block that moves and swaps with the
+// elements, so iterators keep following them like s21::vector ones
+template <typename T, typename Allocator = std::allocator<T>>
+class segmented_vector {
+  template <typename Reference>
+  class SegmentedIterator;
+
+ public:
+  // Segmented vector Member Type
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = SegmentedIterator<reference>;
+  using const_iterator = SegmentedIterator<const_reference>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using allocator_type = Allocator;
+
+  // Segmented vector Member functions
+  segmented_vector() noexcept(noexcept(Allocator()));
+  explicit segmented_vector(const Allocator &alloc) noexcept;
+  explicit segmented_vector(size_type n, const Allocator &alloc = Allocator());
+  segmented_vector(std::initializer_list<value_type> const &items,
+                   const Allocator &alloc = Allocator());
+  segmented_vector(const segmented_vector &v);
+  segmented_vector(segmented_vector &&v) noexcept;
+  ~segmented_vector();
+
+  segmented_vector &operator=(const segmented_vector &v);
+  segmented_vector &operator=(segmented_vector &&v) noexcept(
+      kMoveAssignNoexcept);
+  segmented_vector &operator=(std::initializer_list<value_type> const &items);
+
+  allocator_type get_allocator() const noexcept;
+
+  // Segmented vector Element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) noexcept;
+  const_reference operator[](size_type pos) const noexcept;
+  const_reference front() const noexcept;
+  const_reference back() const noexcept;
+
+  // Segmented vector iterators
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Segmented vector capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+  size_type capacity() const noexcept;
+  void shrink_to_fit();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
+
+  // Segmented vector modifiers
+  void clear() noexcept;
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type &&value);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void pop_back();
+  void swap(segmented_vector &other) noexcept;
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static constexpr size_type kFirstSegmentShift = 3;
+  static constexpr size_type kFirstSegmentSize = size_type(1)
+                                                 << kFirstSegmentShift;
+  static constexpr size_type kMaxSegments =
+      sizeof(size_type) * 8 - kFirstSegmentShift;
+  static constexpr bool kMoveAssignNoexcept =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+  using table_allocator =
+      typename alloc_traits::template rebind_alloc<value_type *>;
+  using table_traits = std::allocator_traits<table_allocator>;
+
+  // kMaxSegments segment pointers, allocated with the first segment
+  T **segments_;
+  size_type segment_count_;
+  size_type size_;
+  Allocator alloc_;
+
+  value_type *SlotAt(size_type index) const noexcept;
+  void AddSegment();
+  void FreeSegments(size_type keep) noexcept;
+  void FreeTable() noexcept;
+  void StealSegments(segmented_vector &v) noexcept;
+
+  static size_type SegmentOf(size_type index) noexcept;
+  static size_type SegmentStart(size_type segment) noexcept;
+  static size_type SegmentSize(size_type segment) noexcept;
+};
+
+// Random access iterator that walks one segment with a plain pointer and
+// looks the next segment up only when it crosses a boundary
+template <typename T, typename Allocator>
+template <typename Reference>
+class segmented_vector<T, Allocator>::SegmentedIterator {
+ public:
+  template <typename>
+  friend class SegmentedIterator;
+  friend class segmented_vector<T, Allocator>;
+
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using reference = Reference;
+  using pointer = std::remove_reference_t<Reference> *;
+
+  SegmentedIterator() = default;
+  template <typename U>
+  SegmentedIterator(const SegmentedIterator<U> &it)
+      : segments_(it.segments_),
+        index_(it.index_),
+        current_(it.current_),
+        segment_begin_(it.segment_begin_),
+        segment_end_(it.segment_end_) {}
+
+  reference operator*() const { return *current_; }
+  pointer operator->() const { return current_; }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  SegmentedIterator &operator++() {
+    ++index_;
+    if (++current_ == segment_end_) {
+      Seek(index_);
+    }
+    return *this;
+  }
+
+  SegmentedIterator operator++(int) {
+    SegmentedIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  SegmentedIterator &operator--() {
+    --index_;
+    if (current_ == segment_begin_) {
+      Seek(index_);
+    } else {
+      --current_;
+    }
+    return *this;
+  }
+
+  SegmentedIterator operator--(int) {
+    SegmentedIterator tmp = *this;
+    --(*this);
+    return tmp;
+  }
+
+  SegmentedIterator &operator+=(difference_type n) {
+    Seek(index_ + n);
+    return *this;
+  }
+
+  SegmentedIterator &operator-=(difference_type n) {
+    Seek(index_ - n);
+    return *this;
+  }
+
+  SegmentedIterator operator+(difference_type n) const {
+    SegmentedIterator tmp = *this;
+    return tmp += n;
+  }
+
+  friend SegmentedIterator operator+(difference_type n,
+                                     const SegmentedIterator &it) {
+    return it + n;
+  }
+
+  SegmentedIterator operator-(difference_type n) const {
+    SegmentedIterator tmp = *this;
+    return tmp -= n;
+  }
+
+  template <typename U>
+  difference_type operator-(const SegmentedIterator<U> &other) const {
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  template <typename U>
+  bool operator==(const SegmentedIterator<U> &other) const {
+    return index_ == other.index_;
+  }
+  template <typename U>
+  bool operator!=(const SegmentedIterator<U> &other) const {
+    return index_ != other.index_;
+  }
+  template <typename U>
+  bool operator<(const SegmentedIterator<U> &other) const {
+    return index_ < other.index_;
+  }
+  template <typename U>
+  bool operator>(const SegmentedIterator<U> &other) const {
+    return index_ > other.index_;
+  }
+  template <typename U>
+  bool operator<=(const SegmentedIterator<U> &other) const {
+    return index_ <= other.index_;
+  }
+  template <typename U>
+  bool operator>=(const SegmentedIterator<U> &other) const {
+    return index_ >= other.index_;
+  }
+
+ private:
+  SegmentedIterator(T *const *segments, size_type index)
+      : segments_(segments) {
+    Seek(index);
+  }
+
+  // Past the last allocated segment only end() can point, it gets no element
+  void Seek(size_type index) {
+    index_ = index;
+    size_type segment = SegmentOf(index);
+    if (segments_ != nullptr && segment < kMaxSegments &&
+        segments_[segment] != nullptr) {
+      segment_begin_ = segments_[segment];
+      segment_end_ = segment_begin_ + SegmentSize(segment);
+      current_ = segment_begin_ + (index - SegmentStart(segment));
+    } else {
+      segment_begin_ = segment_end_ = current_ = nullptr;
+    }
+  }
+
+  T *const *segments_ = nullptr;
+  size_type index_ = 0;
+  pointer current_ = nullptr;
+  pointer segment_begin_ = nullptr;
+  pointer segment_end_ = nullptr;
+};
+
+// Segmented vector Member functions
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator>::segmented_vector() noexcept(
+    noexcept(Allocator()))
+    : segments_(nullptr), segment_count_(0), size_(0), alloc_() {}
+
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator>::segmented_vector(
+    const Allocator &alloc) noexcept
+    : segments_(nullptr), segment_count_(0), size_(0), alloc_(alloc) {}
+
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator>::segmented_vector(size_type n,
+                                                 const Allocator &alloc)
+    : segmented_vector(alloc) {
+  resize(n);
+}
+
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator>::segmented_vector(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : segmented_vector(alloc) {
+  reserve(items.size());
+  for (const auto &item : items) {
+    emplace_back(item);
+  }
+}
+
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator>::segmented_vector(const segmented_vector &v)
+    : segmented_vector(
+          alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+  reserve(v.size_);
+  for (size_type i = 0; i < v.size_; ++i) {
+    emplace_back(v[i]);
+  }
+}
+
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator>::segmented_vector(
+    segmented_vector &&v) noexcept
+    : segments_(nullptr),
+      segment_count_(0),
+      size_(0),
+      alloc_(std::move(v.alloc_)) {
+  StealSegments(v);
+}
+
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator>::~segmented_vector() {
+  clear();
+  FreeTable();
+}
+
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator> &segmented_vector<T, Allocator>::operator=(
+    const segmented_vector &v) {
+  if (this == &v) {
+    return *this;
+  }
+  clear();
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+    if (alloc_ != v.alloc_) {
+      FreeTable();
+    }
+    alloc_ = v.alloc_;
+  }
+  reserve(v.size_);
+  for (size_type i = 0; i < v.size_; ++i) {
+    emplace_back(v[i]);
+  }
+  return *this;
+}
+
+// Like s21::vector, the segments only change hands when the allocators
+// allow it, otherwise the elements are moved one by one
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator> &segmented_vector<T, Allocator>::operator=(
+    segmented_vector &&v) noexcept(kMoveAssignNoexcept) {
+  if (this == &v) {
+    return *this;
+  }
+  clear();
+  if (kMoveAssignNoexcept || alloc_ == v.alloc_) {
+    FreeTable();
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      alloc_ = std::move(v.alloc_);
+    }
+    StealSegments(v);
+  } else {
+    reserve(v.size_);
+    for (size_type i = 0; i < v.size_; ++i) {
+      emplace_back(std::move(v[i]));
+    }
+    v.clear();
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+segmented_vector<T, Allocator> &segmented_vector<T, Allocator>::operator=(
+    std::initializer_list<value_type> const &items) {
+  clear();
+  reserve(items.size());
+  for (const auto &item : items) {
+    emplace_back(item);
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::allocator_type
+segmented_vector<T, Allocator>::get_allocator() const noexcept {
+  return alloc_;
+}
+
+// Segmented vector Element access
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::reference
+segmented_vector<T, Allocator>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("accessing segmented_vector element out of range");
+  }
+  return *SlotAt(pos);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::const_reference
+segmented_vector<T, Allocator>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("accessing segmented_vector element out of range");
+  }
+  return *SlotAt(pos);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::reference
+segmented_vector<T, Allocator>::operator[](size_type pos) noexcept {
+  return *SlotAt(pos);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::const_reference
+segmented_vector<T, Allocator>::operator[](size_type pos) const noexcept {
+  return *SlotAt(pos);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::const_reference
+segmented_vector<T, Allocator>::front() const noexcept {
+  return *SlotAt(0);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::const_reference
+segmented_vector<T, Allocator>::back() const noexcept {
+  return *SlotAt(size_ - 1);
+}
+
+// Segmented vector iterators
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::iterator
+segmented_vector<T, Allocator>::begin() noexcept {
+  return iterator(segments_, 0);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::const_iterator
+segmented_vector<T, Allocator>::begin() const noexcept {
+  return const_iterator(segments_, 0);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::const_iterator
+segmented_vector<T, Allocator>::cbegin() const noexcept {
+  return const_iterator(segments_, 0);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::iterator
+segmented_vector<T, Allocator>::end() noexcept {
+  return iterator(segments_, size_);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::const_iterator
+segmented_vector<T, Allocator>::end() const noexcept {
+  return const_iterator(segments_, size_);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::const_iterator
+segmented_vector<T, Allocator>::cend() const noexcept {
+  return const_iterator(segments_, size_);
+}
+
+// Segmented vector capacity
+template <typename T, typename Allocator>
+bool segmented_vector<T, Allocator>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::size_type
+segmented_vector<T, Allocator>::size() const noexcept {
+  return size_;
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::size_type
+segmented_vector<T, Allocator>::max_size() const noexcept {
+  return std::min(alloc_traits::max_size(alloc_),
+                  SegmentStart(kMaxSegments - 1));
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("segmented_vector size exceeds max_size");
+  }
+  while (capacity() < size) {
+    AddSegment();
+  }
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::size_type
+segmented_vector<T, Allocator>::capacity() const noexcept {
+  return SegmentStart(segment_count_);
+}
+
+// Releases the segments past the one holding the last element
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::shrink_to_fit() {
+  FreeSegments(size_ == 0 ? 0 : SegmentOf(size_ - 1) + 1);
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::resize(size_type count) {
+  if (count < size_) {
+    erase(cbegin() + count, cend());
+  }
+  reserve(count);
+  while (size_ < count) {
+    emplace_back();
+  }
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::resize(size_type count,
+                                            const_reference value) {
+  if (count < size_) {
+    erase(cbegin() + count, cend());
+  }
+  // elements never move while appending, so value stays valid
+  reserve(count);
+  while (size_ < count) {
+    emplace_back(value);
+  }
+}
+
+// Segmented vector modifiers
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::clear() noexcept {
+  while (size_ != 0) {
+    pop_back();
+  }
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::iterator
+segmented_vector<T, Allocator>::insert(const_iterator pos,
+                                       const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::iterator
+segmented_vector<T, Allocator>::insert(const_iterator pos,
+                                       value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::iterator
+segmented_vector<T, Allocator>::erase(const_iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::iterator
+segmented_vector<T, Allocator>::erase(const_iterator first,
+                                      const_iterator last) {
+  size_type index = first.index_;
+  size_type count = last.index_ - first.index_;
+  std::move(begin() + last.index_, end(), begin() + index);
+  while (count-- != 0) {
+    pop_back();
+  }
+  return begin() + index;
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::pop_back() {
+  --size_;
+  alloc_traits::destroy(alloc_, SlotAt(size_));
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::swap(segmented_vector &other) noexcept {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(alloc_, other.alloc_);
+  }
+  std::swap(segments_, other.segments_);
+  std::swap(segment_count_, other.segment_count_);
+  std::swap(size_, other.size_);
+}
+
+// The new element is appended and rotated into place, which moves only the
+// elements after pos
+template <typename T, typename Allocator>
+template <typename... Args>
+typename segmented_vector<T, Allocator>::iterator
+segmented_vector<T, Allocator>::emplace(const_iterator pos, Args &&...args) {
+  size_type index = pos.index_;
+  emplace_back(std::forward<Args>(args)...);
+  std::rotate(begin() + index, end() - 1, end());
+  return begin() + index;
+}
+
+// Appending never relocates the existing elements, so args may refer to them
+template <typename T, typename Allocator>
+template <typename... Args>
+typename segmented_vector<T, Allocator>::reference
+segmented_vector<T, Allocator>::emplace_back(Args &&...args) {
+  if (size_ == capacity()) {
+    AddSegment();
+  }
+  value_type *slot = SlotAt(size_);
+  alloc_traits::construct(alloc_, slot, std::forward<Args>(args)...);
+  ++size_;
+  return *slot;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename segmented_vector<T, Allocator>::iterator
+segmented_vector<T, Allocator>::insert_many(const_iterator pos,
+                                            Args &&...args) {
+  size_type index = pos.index_;
+  size_type old_size = size_;
+  (emplace_back(std::forward<Args>(args)), ...);
+  std::rotate(begin() + index, begin() + old_size, end());
+  return begin() + index;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+void segmented_vector<T, Allocator>::insert_many_back(Args &&...args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::value_type *
+segmented_vector<T, Allocator>::SlotAt(size_type index) const noexcept {
+  size_type segment = SegmentOf(index);
+  return segments_[segment] + (index - SegmentStart(segment));
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::AddSegment() {
+  if (segment_count_ == kMaxSegments) {
+    throw std::length_error("segmented_vector size exceeds max_size");
+  }
+  if (segments_ == nullptr) {
+    table_allocator table_alloc(alloc_);
+    segments_ = table_traits::allocate(table_alloc, kMaxSegments);
+    std::fill(segments_, segments_ + kMaxSegments, nullptr);
+  }
+  segments_[segment_count_] =
+      alloc_traits::allocate(alloc_, SegmentSize(segment_count_));
+  ++segment_count_;
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::FreeSegments(size_type keep) noexcept {
+  while (segment_count_ > keep) {
+    --segment_count_;
+    alloc_traits::deallocate(alloc_, segments_[segment_count_],
+                             SegmentSize(segment_count_));
+    segments_[segment_count_] = nullptr;
+  }
+}
+
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::FreeTable() noexcept {
+  FreeSegments(0);
+  if (segments_ != nullptr) {
+    table_allocator table_alloc(alloc_);
+    table_traits::deallocate(table_alloc, segments_, kMaxSegments);
+    segments_ = nullptr;
+  }
+}
+
+// Takes over the table block of v, so iterators into v stay valid
+template <typename T, typename Allocator>
+void segmented_vector<T, Allocator>::StealSegments(
+    segmented_vector &v) noexcept {
+  segments_ = v.segments_;
+  segment_count_ = v.segment_count_;
+  size_ = v.size_;
+
+  v.segments_ = nullptr;
+  v.segment_count_ = 0;
+  v.size_ = 0;
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::size_type
+segmented_vector<T, Allocator>::SegmentOf(size_type index) noexcept {
+  size_type shifted = (index >> kFirstSegmentShift) + 1;
+#if defined(__GNUC__) || defined(__clang__)
+  return sizeof(unsigned long long) * 8 - 1 -
+         __builtin_clzll(static_cast<unsigned long long>(shifted));
+#else
+  size_type segment = 0;
+  while (shifted >>= 1) {
+    ++segment;
+  }
+  return segment;
+#endif
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::size_type
+segmented_vector<T, Allocator>::SegmentStart(size_type segment) noexcept {
+  return (kFirstSegmentSize << segment) - kFirstSegmentSize;
+}
+
+template <typename T, typename Allocator>
+typename segmented_vector<T, Allocator>::size_type
+segmented_vector<T, Allocator>::SegmentSize(size_type segment) noexcept {
+  return kFirstSegmentSize << segment;
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_SEGMENTED_VECTOR_H_
@@ -0,0 +1,469 @@
+#ifndef S21_CONTAINERS_SRC_S21_SERIALIZE_H_
+#define S21_CONTAINERS_SRC_S21_SERIALIZE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_containers.h"
+#include "s21_array.h"
+#include "s21_multiset.h"
+
+namespace s21 {
+// Binary serialization of the s21 containers. A container is written as a
+// 24-byte header (magic, format version, container kind, element size and
+// element count) followed by its elements in iteration order, in host byte
+// order. Trivially copyable elements of vector and array leave in a single
+// stream write, and node-based containers batch them through a 4 KiB buffer.
+// Trees are read back in key order and rebuilt by assign_sorted in O(n)
+// instead of n inserts. Nested containers carry their own header. Other
+// element types plug in by specializing s21::serializer with static
+// write(std::ostream &, const T &) and read(std::istream &, T &)
+template <typename T, typename Enable = void>
+struct serializer;
+
+// Writes value to out. Throws std::ios_base::failure when the stream fails
+template <typename T>
+void serialize(std::ostream &out, const T &value) {
+  serializer<T>::write(out, value);
+}
+
+// Replaces value with the next one in in. Throws std::invalid_argument when
+// the stream holds another container, another format version or elements of
+// another size, and std::ios_base::failure when it ends early
+template <typename T>
+void deserialize(std::istream &in, T &value) {
+  serializer<T>::read(in, value);
+}
+
+namespace detail {
+enum class SerialKind : uint16_t {
+  kVector = 1,
+  kArray,
+  kList,
+  kSet,
+  kMultiset,
+  kMap,
+  kBitVector
+};
+
+struct SerialHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t kind;
+  uint32_t element_size;
+  uint32_t reserved;
+  uint64_t size;
+};
+
+static_assert(sizeof(SerialHeader) == 24, "unexpected header padding");
+
+inline constexpr uint32_t kSerialMagic = 0x43313253;  // "S21C"
+inline constexpr uint16_t kSerialVersion = 1;
+inline constexpr size_t kSerialChunk = 4096;
+
+// Elements stored as their object representation
+template <typename T>
+inline constexpr bool kRawSerial =
+    std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>;
+
+template <typename T>
+constexpr uint32_t SerialElementSize() {
+  return kRawSerial<T> ? static_cast<uint32_t>(sizeof(T)) : 0;
+}
+
+inline void WriteBytes(std::ostream &out, const void *data, size_t bytes) {
+  out.write(static_cast<const char *>(data),
+            static_cast<std::streamsize>(bytes));
+  if (!out) throw std::ios_base::failure("s21::serialize: write failed");
+}
+
+inline void ReadBytes(std::istream &in, void *data, size_t bytes) {
+  in.read(static_cast<char *>(data), static_cast<std::streamsize>(bytes));
+  if (static_cast<size_t>(in.gcount()) != bytes) {
+    throw std::ios_base::failure("s21::deserialize: unexpected end of stream");
+  }
+}
+
+inline void WriteHeader(std::ostream &out, SerialKind kind,
+                        uint32_t element_size, uint64_t size) {
+  SerialHeader header{kSerialMagic,
+                      kSerialVersion,
+                      static_cast<uint16_t>(kind),
+                      element_size,
+                      0,
+                      size};
+  WriteBytes(out, &header, sizeof(header));
+}
+
+// Returns the element count after checking the header against the reader
+inline uint64_t ReadHeader(std::istream &in, SerialKind kind,
+                           uint32_t element_size) {
+  SerialHeader header;
+  ReadBytes(in, &header, sizeof(header));
+  if (header.magic != kSerialMagic) {
+    throw std::invalid_argument("s21::deserialize: not an s21 container");
+  }
+  if (header.version != kSerialVersion) {
+    throw std::invalid_argument("s21::deserialize: unsupported version");
+  }
+  if (header.kind != static_cast<uint16_t>(kind)) {
+    throw std::invalid_argument("s21::deserialize: container kind mismatch");
+  }
+  if (header.element_size != element_size) {
+    throw std::invalid_argument("s21::deserialize: element size mismatch");
+  }
+  return header.size;
+}
+
+template <typename T>
+void WriteElements(std::ostream &out, const T *first, size_t count) {
+  if constexpr (kRawSerial<T>) {
+    WriteBytes(out, first, count * sizeof(T));
+  } else {
+    for (size_t i = 0; i < count; ++i) serializer<T>::write(out, first[i]);
+  }
+}
+
+template <typename T>
+void ReadElements(std::istream &in, T *first, size_t count) {
+  if constexpr (kRawSerial<T>) {
+    ReadBytes(in, first, count * sizeof(T));
+  } else {
+    for (size_t i = 0; i < count; ++i) serializer<T>::read(in, first[i]);
+  }
+}
+
+// Writes the elements of a node-based container, packing raw ones so the
+// stream sees one write per chunk rather than one per element
+template <typename T, typename Iterator>
+void WriteNodes(std::ostream &out, Iterator first, Iterator last) {
+  if constexpr (kRawSerial<T> && sizeof(T) <= kSerialChunk) {
+    alignas(T) char buffer[kSerialChunk];
+    size_t used = 0;
+    for (; first != last; ++first) {
+      if (used + sizeof(T) > sizeof(buffer)) {
+        WriteBytes(out, buffer, used);
+        used = 0;
+      }
+      const T &value = *first;
+      std::memcpy(buffer + used, &value, sizeof(T));
+      used += sizeof(T);
+    }
+    if (used != 0) WriteBytes(out, buffer, used);
+  } else {
+    for (; first != last; ++first) serializer<T>::write(out, *first);
+  }
+}
+
+// Reads count elements one at a time, refilling a chunk of raw ones with a
+// single stream read
+template <typename T>
+class NodeReader {
+ public:
+  NodeReader(std::istream &in, uint64_t count) : in_(in), remaining_(count) {}
+
+  void next(T &value) {
+    if constexpr (kRawSerial<T> && sizeof(T) <= kSerialChunk) {
+      if (used_ == filled_) {
+        uint64_t fits = kSerialChunk / sizeof(T);
+        size_t count = static_cast<size_t>(std::min(remaining_, fits));
+        ReadBytes(in_, buffer_, count * sizeof(T));
+        remaining_ -= count;
+        filled_ = count * sizeof(T);
+        used_ = 0;
+      }
+      std::memcpy(&value, buffer_ + used_, sizeof(T));
+      used_ += sizeof(T);
+    } else {
+      serializer<T>::read(in_, value);
+    }
+  }
+
+ private:
+  std::istream &in_;
+  uint64_t remaining_;
+  size_t used_ = 0;
+  size_t filled_ = 0;
+  alignas(T) char buffer_[kRawSerial<T> ? kSerialChunk : 1];
+};
+
+// Checks that a rebuilt tree is in key order, so a corrupted stream can not
+// leave it unsearchable
+template <typename Iterator, typename Less>
+bool InKeyOrder(Iterator first, Iterator last, bool unique, Less less) {
+  if (first == last) return true;
+  Iterator previous = first;
+  for (++first; first != last; ++first) {
+    if (unique ? !less(*previous, *first) : less(*first, *previous)) {
+      return false;
+    }
+    previous = first;
+  }
+  return true;
+}
+}  // namespace detail
+
+// Trivially copyable values are stored as their object representation
+template <typename T>
+struct serializer<T, std::enable_if_t<detail::kRawSerial<T>>> {
+  static void write(std::ostream &out, const T &value) {
+    detail::WriteBytes(out, &value, sizeof(T));
+  }
+
+  static void read(std::istream &in, T &value) {
+    detail::ReadBytes(in, &value, sizeof(T));
+  }
+};
+
+// Strings are stored as a 64-bit length followed by the characters
+template <typename CharT, typename Traits, typename Alloc>
+struct serializer<std::basic_string<CharT, Traits, Alloc>> {
+  using String = std::basic_string<CharT, Traits, Alloc>;
+
+  static void write(std::ostream &out, const String &value) {
+    uint64_t length = value.size();
+    detail::WriteBytes(out, &length, sizeof(length));
+    detail::WriteBytes(out, value.data(), value.size() * sizeof(CharT));
+  }
+
+  static void read(std::istream &in, String &value) {
+    uint64_t length = 0;
+    detail::ReadBytes(in, &length, sizeof(length));
+    if (length > value.max_size()) {
+      throw std::invalid_argument("s21::deserialize: string is too long");
+    }
+    value.resize(static_cast<size_t>(length));
+    detail::ReadBytes(in, value.data(), value.size() * sizeof(CharT));
+  }
+};
+
+template <typename First, typename Second>
+struct serializer<std::pair<First, Second>,
+                  std::enable_if_t<!detail::kRawSerial<
+                      std::pair<First, Second>>>> {
+  static void write(std::ostream &out, const std::pair<First, Second> &value) {
+    serializer<First>::write(out, value.first);
+    serializer<Second>::write(out, value.second);
+  }
+
+  static void read(std::istream &in, std::pair<First, Second> &value) {
+    serializer<First>::read(in, value.first);
+    serializer<Second>::read(in, value.second);
+  }
+};
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+struct serializer<vector<T, Allocator, GrowthPolicy, N>> {
+  using Vector = vector<T, Allocator, GrowthPolicy, N>;
+
+  static void write(std::ostream &out, const Vector &value) {
+    size_t size = static_cast<size_t>(value.cend() - value.cbegin());
+    detail::WriteHeader(out, detail::SerialKind::kVector,
+                        detail::SerialElementSize<T>(), size);
+    detail::WriteElements(out, value.cbegin(), size);
+  }
+
+  static void read(std::istream &in, Vector &value) {
+    uint64_t size = detail::ReadHeader(in, detail::SerialKind::kVector,
+                                       detail::SerialElementSize<T>());
+    if (size > value.max_size()) {
+      throw std::invalid_argument("s21::deserialize: vector is too long");
+    }
+    value.clear();
+    ReadInto(in, value, static_cast<size_t>(size));
+  }
+
+  // The vector grows with the data actually read, so a corrupt count ends
+  // with "unexpected end of stream" rather than a huge allocation
+  static void ReadInto(std::istream &in, Vector &value, size_t size) {
+    if constexpr (detail::kRawSerial<T> && sizeof(T) <= detail::kSerialChunk) {
+      alignas(T) char buffer[detail::kSerialChunk];
+      while (size != 0) {
+        size_t count = std::min(size, sizeof(buffer) / sizeof(T));
+        detail::ReadBytes(in, buffer, count * sizeof(T));
+        value.append(reinterpret_cast<const T *>(buffer), count);
+        size -= count;
+      }
+    } else {
+      for (; size != 0; --size) {
+        value.emplace_back();
+        serializer<T>::read(in, value[value.size() - 1]);
+      }
+    }
+  }
+};
+
+// The packed vector<bool> is written as its bit count and its 64-bit words
+template <typename Allocator, typename GrowthPolicy, size_t N>
+struct serializer<vector<bool, Allocator, GrowthPolicy, N>> {
+  using Vector = vector<bool, Allocator, GrowthPolicy, N>;
+  using word_type = typename Vector::word_type;
+
+  static void write(std::ostream &out, const Vector &value) {
+    detail::WriteHeader(out, detail::SerialKind::kBitVector,
+                        sizeof(word_type), value.size());
+    detail::WriteBytes(out, value.data(),
+                       WordCount(value.size()) * sizeof(word_type));
+  }
+
+  // Bits past the count are cleared, the vector relies on them being zero
+  static void read(std::istream &in, Vector &value) {
+    uint64_t size = detail::ReadHeader(in, detail::SerialKind::kBitVector,
+                                       sizeof(word_type));
+    if (size > value.max_size()) {
+      throw std::invalid_argument("s21::deserialize: vector is too long");
+    }
+    value.clear();
+    // Grown one chunk at a time, at most doubling, like the vector reader
+    size_t read = 0;
+    while (read != size) {
+      size_t step = std::max(read, detail::kSerialChunk * 8);
+      size_t bits = static_cast<size_t>(std::min<uint64_t>(size, read + step));
+      value.resize(bits);
+      size_t first = read / Vector::kWordBits;
+      size_t words = WordCount(bits);
+      detail::ReadBytes(in, value.data() + first,
+                        (words - first) * sizeof(word_type));
+      read = bits;
+    }
+    if (size_t tail = value.size() % Vector::kWordBits; tail != 0) {
+      value.data()[WordCount(value.size()) - 1] &=
+          ~word_type(0) >> (Vector::kWordBits - tail);
+    }
+  }
+
+  static size_t WordCount(size_t size) {
+    return (size + Vector::kWordBits - 1) / Vector::kWordBits;
+  }
+};
+
+template <typename T, size_t N>
+struct serializer<array<T, N>> {
+  static void write(std::ostream &out, const array<T, N> &value) {
+    detail::WriteHeader(out, detail::SerialKind::kArray,
+                        detail::SerialElementSize<T>(), N);
+    detail::WriteElements(out, value.begin(), N);
+  }
+
+  static void read(std::istream &in, array<T, N> &value) {
+    uint64_t size = detail::ReadHeader(in, detail::SerialKind::kArray,
+                                       detail::SerialElementSize<T>());
+    if (size != N) {
+      throw std::invalid_argument("s21::deserialize: array size mismatch");
+    }
+    detail::ReadElements(in, value.begin(), N);
+  }
+};
+
+template <typename T>
+struct serializer<list<T>> {
+  static void write(std::ostream &out, const list<T> &value) {
+    detail::WriteHeader(out, detail::SerialKind::kList,
+                        detail::SerialElementSize<T>(), value.size());
+    detail::WriteNodes<T>(out, value.cbegin(), value.cend());
+  }
+
+  static void read(std::istream &in, list<T> &value) {
+    uint64_t size = detail::ReadHeader(in, detail::SerialKind::kList,
+                                       detail::SerialElementSize<T>());
+    while (!value.empty()) value.pop_front();
+    detail::NodeReader<T> reader(in, size);
+    for (uint64_t i = 0; i < size; ++i) {
+      T element{};
+      reader.next(element);
+      value.push_back(element);
+    }
+  }
+};
+
+template <typename T>
+struct serializer<set<T>> {
+  static void write(std::ostream &out, const set<T> &value) {
+    detail::WriteHeader(out, detail::SerialKind::kSet,
+                        detail::SerialElementSize<T>(), value.size());
+    detail::WriteNodes<T>(out, value.cbegin(), value.cend());
+  }
+
+  static void read(std::istream &in, set<T> &value) {
+    uint64_t size = detail::ReadHeader(in, detail::SerialKind::kSet,
+                                       detail::SerialElementSize<T>());
+    detail::NodeReader<T> reader(in, size);
+    value.assign_sorted(static_cast<size_t>(size), [&reader] {
+      T element{};
+      reader.next(element);
+      return element;
+    });
+    if (!detail::InKeyOrder(value.cbegin(), value.cend(), true,
+                            [](const T &a, const T &b) { return a < b; })) {
+      value.assign_sorted(0, [] { return T(); });
+      throw std::invalid_argument("s21::deserialize: set is not sorted");
+    }
+  }
+};
+
+template <typename Key>
+struct serializer<multiset<Key>> {
+  static void write(std::ostream &out, const multiset<Key> &value) {
+    detail::WriteHeader(out, detail::SerialKind::kMultiset,
+                        detail::SerialElementSize<Key>(), value.size());
+    detail::WriteNodes<Key>(out, value.begin(), value.end());
+  }
+
+  static void read(std::istream &in, multiset<Key> &value) {
+    using Stored = typename multiset<Key>::Base::value_type;
+    uint64_t size = detail::ReadHeader(in, detail::SerialKind::kMultiset,
+                                       detail::SerialElementSize<Key>());
+    detail::NodeReader<Key> reader(in, size);
+    value.assign_sorted(static_cast<size_t>(size), [&reader] {
+      Stored element{};
+      reader.next(element.first);
+      return element;
+    });
+    if (!detail::InKeyOrder(value.begin(), value.end(), false,
+                            [](const Key &a, const Key &b) { return a < b; })) {
+      value.clear();
+      throw std::invalid_argument("s21::deserialize: multiset is not sorted");
+    }
+  }
+};
+
+template <typename Key, typename T>
+struct serializer<map<Key, T>> {
+  using value_type = typename map<Key, T>::value_type;
+
+  static void write(std::ostream &out, const map<Key, T> &value) {
+    detail::WriteHeader(out, detail::SerialKind::kMap,
+                        detail::SerialElementSize<value_type>(), value.size());
+    detail::WriteNodes<value_type>(out, value.cbegin(), value.cend());
+  }
+
+  static void read(std::istream &in, map<Key, T> &value) {
+    uint64_t size = detail::ReadHeader(in, detail::SerialKind::kMap,
+                                       detail::SerialElementSize<value_type>());
+    detail::NodeReader<value_type> reader(in, size);
+    value.assign_sorted(static_cast<size_t>(size), [&reader] {
+      value_type element{};
+      reader.next(element);
+      return element;
+    });
+    if (!detail::InKeyOrder(value.cbegin(), value.cend(), true,
+                            [](const value_type &a, const value_type &b) {
+                              return a.first < b.first;
+                            })) {
+      value.clear();
+      throw std::invalid_argument("s21::deserialize: map is not sorted");
+    }
+  }
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_SERIALIZE_H_
@@ -38,6 +38,9 @@ class set {
   void TransferBegin();
   void UnitNull();
   void CopySet(const set &s);
+  template <typename Generator>
+  Node<T> *BuildSorted(size_t count, Generator &next);
+  void DestroyNodes(Node<T> *node);
   void OutSet();
 
  public:
@@ -112,9 +115,11 @@ class set {
 
   iterator begin() { return iterator(root_ ? begin_ : end_); };
   iterator end() { return iterator(end_); };
+  const_iterator cbegin() const { return iterator(root_ ? begin_ : end_); };
+  const_iterator cend() const { return iterator(end_); };
 
-  bool empty() { return root_ == nullptr; };
-  size_type size() { return size_; };
+  bool empty() const { return root_ == nullptr; };
+  size_type size() const { return size_; };
   size_type max_size();
 
   void clear();
@@ -125,6 +130,8 @@ class set {
 
   iterator find(const key_type &key);
   bool contains(const key_type &key);
+  template <typename Generator>
+  void assign_sorted(size_type count, Generator next);
 
  private:
   void EraseNormal(iterator pos);
@@ -380,6 +387,24 @@ bool s21::set<value_type>::contains(const key_type &key) {
   return res;
 }
 
+template <typename value_type>
+template <typename Generator>
+void s21::set<value_type>::assign_sorted(size_type count, Generator next) {
+  clear();
+  CreateEnd();
+  if (count == 0) return;
+  root_ = BuildSorted(count, next);
+  size_ = count;
+  begin_ = root_;
+  while (begin_->left_) begin_ = begin_->left_;
+  begin_->left_ = end_;
+  Node<value_type> *last = root_;
+  while (last->right_) last = last->right_;
+  last->right_ = end_;
+  end_->parent_ = last;
+  end_->right_ = last;
+}
+
 template <typename value_type>
 void s21::set<value_type>::CreateEnd() {
   end_ = new Node<value_type>(value_type(), nullptr, nullptr, nullptr);
@@ -432,7 +457,7 @@ void s21::set<value_type>::UnitNull() {
 template <typename value_type>
 void s21::set<value_type>::EraseBegin() {
   if (begin_ == root_) {
-    delete root_;
+    Node<value_type> *old_root = root_;
     if (size_ > 1) {
       root_ = root_->right_;
       root_->parent_ = nullptr;
@@ -446,6 +471,7 @@ void s21::set<value_type>::EraseBegin() {
       end_->parent_ = nullptr;
       end_->right_ = nullptr;
     }
+    delete old_root;
   } else if (begin_->right_) {
     begin_->parent_->left_ = begin_->right_;
     begin_->right_->parent_ = begin_->parent_;
@@ -594,6 +620,39 @@ void s21::set<value_type>::CopySet(const set &s) {
   }
 }
 
+template <typename value_type>
+template <typename Generator>
+typename s21::set<value_type>::template Node<value_type>
+    *s21::set<value_type>::BuildSorted(size_t count, Generator &next) {
+  if (count == 0) return nullptr;
+  size_t left_count = (count - 1) / 2;
+  Node<value_type> *left = BuildSorted(left_count, next);
+  Node<value_type> *node = nullptr;
+  try {
+    node = new Node<value_type>(next(), nullptr, nullptr, left);
+  } catch (...) {
+    DestroyNodes(left);
+    throw;
+  }
+  if (left) left->parent_ = node;
+  try {
+    node->right_ = BuildSorted(count - 1 - left_count, next);
+  } catch (...) {
+    DestroyNodes(node);
+    throw;
+  }
+  if (node->right_) node->right_->parent_ = node;
+  return node;
+}
+
+template <typename value_type>
+void s21::set<value_type>::DestroyNodes(Node<value_type> *node) {
+  if (!node) return;
+  DestroyNodes(node->left_);
+  DestroyNodes(node->right_);
+  delete node;
+}
+
 template <typename value_type>
 void s21::set<value_type>::OutSet() {
   std::cout << "size_ - " << size_ << std::endl;
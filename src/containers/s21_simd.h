@@ -0,0 +1,526 @@
+#ifndef S21_CONTAINERS_SRC_S21_SIMD_H_
+#define S21_CONTAINERS_SRC_S21_SIMD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#define S21_SIMD_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace s21 {
+namespace simd {
+// Sums of integers are accumulated in 64 bits, floating point sums keep the
+// element type but are added in a different order than a plain loop
+template <typename T>
+using sum_type = std::conditional_t<
+    std::is_floating_point_v<T>, T,
+    std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+// Kernels over a contiguous range. int32_t, float and double use SSE2, or
+// AVX2 when the CPU has it; other arithmetic types run the scalar loops.
+// For floating point ranges holding NaN, min_element and max_element return
+// some element of the range but not necessarily the one std:: would
+template <typename T>
+const T *find(const T *first, const T *last,
+              std::remove_cv_t<T> value) noexcept;
+template <typename T>
+size_t count(const T *first, const T *last,
+             std::remove_cv_t<T> value) noexcept;
+template <typename T>
+bool contains(const T *first, const T *last,
+              std::remove_cv_t<T> value) noexcept;
+template <typename T>
+const T *min_element(const T *first, const T *last) noexcept;
+template <typename T>
+const T *max_element(const T *first, const T *last) noexcept;
+template <typename T>
+sum_type<T> sum(const T *first, const T *last) noexcept;
+
+// The same kernels over s21::vector, s21::array or any container whose
+// iterators are plain pointers
+template <typename Container>
+using RequireContiguous = std::enable_if_t<std::is_same_v<
+    typename std::remove_const_t<Container>::const_iterator,
+    const typename std::remove_const_t<Container>::value_type *>>;
+
+template <typename Container, typename = RequireContiguous<Container>>
+const typename Container::value_type *find(
+    Container &c, typename Container::value_type value) noexcept {
+  return find(c.begin(), c.end(), value);
+}
+
+template <typename Container, typename = RequireContiguous<Container>>
+size_t count(Container &c,
+             typename Container::value_type value) noexcept {
+  return count(c.begin(), c.end(), value);
+}
+
+template <typename Container, typename = RequireContiguous<Container>>
+bool contains(Container &c,
+              typename Container::value_type value) noexcept {
+  return contains(c.begin(), c.end(), value);
+}
+
+template <typename Container, typename = RequireContiguous<Container>>
+const typename Container::value_type *min_element(Container &c) noexcept {
+  return min_element(c.begin(), c.end());
+}
+
+template <typename Container, typename = RequireContiguous<Container>>
+const typename Container::value_type *max_element(Container &c) noexcept {
+  return max_element(c.begin(), c.end());
+}
+
+template <typename Container, typename = RequireContiguous<Container>>
+sum_type<typename Container::value_type> sum(Container &c) noexcept {
+  return sum(c.begin(), c.end());
+}
+
+namespace detail {
+template <typename T>
+const T *FindScalar(const T *first, const T *last, T value) noexcept {
+  for (; first != last; ++first) {
+    if (*first == value) {
+      return first;
+    }
+  }
+  return last;
+}
+
+template <typename T>
+size_t CountScalar(const T *first, const T *last, T value) noexcept {
+  size_t result = 0;
+  for (; first != last; ++first) {
+    result += *first == value;
+  }
+  return result;
+}
+
+template <typename T>
+const T *MinScalar(const T *first, const T *last) noexcept {
+  const T *best = first;
+  for (; first != last; ++first) {
+    if (*first < *best) {
+      best = first;
+    }
+  }
+  return best;
+}
+
+template <typename T>
+const T *MaxScalar(const T *first, const T *last) noexcept {
+  const T *best = first;
+  for (; first != last; ++first) {
+    if (*best < *first) {
+      best = first;
+    }
+  }
+  return best;
+}
+
+template <typename T>
+sum_type<T> SumScalar(const T *first, const T *last) noexcept {
+  sum_type<T> result = 0;
+  for (; first != last; ++first) {
+    result += *first;
+  }
+  return result;
+}
+
+#ifdef S21_SIMD_X86
+template <typename T>
+constexpr bool kVectorized = std::is_same_v<T, int32_t> ||
+                             std::is_same_v<T, float> ||
+                             std::is_same_v<T, double>;
+
+inline bool HasAvx2() noexcept {
+  static const bool has_avx2 = __builtin_cpu_supports("avx2");
+  return has_avx2;
+}
+
+// One register worth of lanes per instruction set and element type. EqMask
+// returns one bit per lane, lowest lane first
+template <typename T>
+struct Sse2Ops;
+
+template <>
+struct Sse2Ops<int32_t> {
+  using reg = __m128i;
+  using acc = __m128i;
+  static constexpr ptrdiff_t kLanes = 4;
+
+  static reg Load(const int32_t *p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  }
+  static reg Set1(int32_t value) { return _mm_set1_epi32(value); }
+  static unsigned EqMask(reg a, reg b) {
+    return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+  }
+  // SSE2 has no pminsd/pmaxsd, so blend on a compare
+  static reg Min(reg a, reg b) {
+    reg lt = _mm_cmplt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(lt, a), _mm_andnot_si128(lt, b));
+  }
+  static reg Max(reg a, reg b) {
+    reg gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+  }
+  static acc Zero() { return _mm_setzero_si128(); }
+  static acc Accumulate(acc sum, reg a) {
+    reg sign = _mm_srai_epi32(a, 31);
+    sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(a, sign));
+    return _mm_add_epi64(sum, _mm_unpackhi_epi32(a, sign));
+  }
+  static int64_t Reduce(acc sum) {
+    alignas(16) int64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), sum);
+    return lanes[0] + lanes[1];
+  }
+  static void Store(int32_t *p, reg a) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), a);
+  }
+};
+
+template <>
+struct Sse2Ops<float> {
+  using reg = __m128;
+  using acc = __m128;
+  static constexpr ptrdiff_t kLanes = 4;
+
+  static reg Load(const float *p) { return _mm_loadu_ps(p); }
+  static reg Set1(float value) { return _mm_set1_ps(value); }
+  static unsigned EqMask(reg a, reg b) {
+    return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+  }
+  static reg Min(reg a, reg b) { return _mm_min_ps(a, b); }
+  static reg Max(reg a, reg b) { return _mm_max_ps(a, b); }
+  static acc Zero() { return _mm_setzero_ps(); }
+  static acc Accumulate(acc sum, reg a) { return _mm_add_ps(sum, a); }
+  static float Reduce(acc sum) {
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, sum);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  }
+  static void Store(float *p, reg a) { _mm_storeu_ps(p, a); }
+};
+
+template <>
+struct Sse2Ops<double> {
+  using reg = __m128d;
+  using acc = __m128d;
+  static constexpr ptrdiff_t kLanes = 2;
+
+  static reg Load(const double *p) { return _mm_loadu_pd(p); }
+  static reg Set1(double value) { return _mm_set1_pd(value); }
+  static unsigned EqMask(reg a, reg b) {
+    return _mm_movemask_pd(_mm_cmpeq_pd(a, b));
+  }
+  static reg Min(reg a, reg b) { return _mm_min_pd(a, b); }
+  static reg Max(reg a, reg b) { return _mm_max_pd(a, b); }
+  static acc Zero() { return _mm_setzero_pd(); }
+  static acc Accumulate(acc sum, reg a) { return _mm_add_pd(sum, a); }
+  static double Reduce(acc sum) {
+    alignas(16) double lanes[2];
+    _mm_store_pd(lanes, sum);
+    return lanes[0] + lanes[1];
+  }
+  static void Store(double *p, reg a) { _mm_storeu_pd(p, a); }
+};
+
+template <typename T>
+struct Avx2Ops;
+
+template <>
+struct Avx2Ops<int32_t> {
+  using reg = __m256i;
+  using acc = __m256i;
+  static constexpr ptrdiff_t kLanes = 8;
+
+  S21_SIMD_AVX2 static reg Load(const int32_t *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+  S21_SIMD_AVX2 static reg Set1(int32_t value) {
+    return _mm256_set1_epi32(value);
+  }
+  S21_SIMD_AVX2 static unsigned EqMask(reg a, reg b) {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+  }
+  S21_SIMD_AVX2 static reg Min(reg a, reg b) { return _mm256_min_epi32(a, b); }
+  S21_SIMD_AVX2 static reg Max(reg a, reg b) { return _mm256_max_epi32(a, b); }
+  S21_SIMD_AVX2 static acc Zero() { return _mm256_setzero_si256(); }
+  S21_SIMD_AVX2 static acc Accumulate(acc sum, reg a) {
+    reg low = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(a));
+    reg high = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(a, 1));
+    return _mm256_add_epi64(sum, _mm256_add_epi64(low, high));
+  }
+  S21_SIMD_AVX2 static int64_t Reduce(acc sum) {
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), sum);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  }
+  S21_SIMD_AVX2 static void Store(int32_t *p, reg a) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), a);
+  }
+};
+
+template <>
+struct Avx2Ops<float> {
+  using reg = __m256;
+  using acc = __m256;
+  static constexpr ptrdiff_t kLanes = 8;
+
+  S21_SIMD_AVX2 static reg Load(const float *p) { return _mm256_loadu_ps(p); }
+  S21_SIMD_AVX2 static reg Set1(float value) { return _mm256_set1_ps(value); }
+  S21_SIMD_AVX2 static unsigned EqMask(reg a, reg b) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+  }
+  S21_SIMD_AVX2 static reg Min(reg a, reg b) { return _mm256_min_ps(a, b); }
+  S21_SIMD_AVX2 static reg Max(reg a, reg b) { return _mm256_max_ps(a, b); }
+  S21_SIMD_AVX2 static acc Zero() { return _mm256_setzero_ps(); }
+  S21_SIMD_AVX2 static acc Accumulate(acc sum, reg a) {
+    return _mm256_add_ps(sum, a);
+  }
+  S21_SIMD_AVX2 static float Reduce(acc sum) {
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, sum);
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+           ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+  }
+  S21_SIMD_AVX2 static void Store(float *p, reg a) { _mm256_storeu_ps(p, a); }
+};
+
+template <>
+struct Avx2Ops<double> {
+  using reg = __m256d;
+  using acc = __m256d;
+  static constexpr ptrdiff_t kLanes = 4;
+
+  S21_SIMD_AVX2 static reg Load(const double *p) { return _mm256_loadu_pd(p); }
+  S21_SIMD_AVX2 static reg Set1(double value) { return _mm256_set1_pd(value); }
+  S21_SIMD_AVX2 static unsigned EqMask(reg a, reg b) {
+    return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+  }
+  S21_SIMD_AVX2 static reg Min(reg a, reg b) { return _mm256_min_pd(a, b); }
+  S21_SIMD_AVX2 static reg Max(reg a, reg b) { return _mm256_max_pd(a, b); }
+  S21_SIMD_AVX2 static acc Zero() { return _mm256_setzero_pd(); }
+  S21_SIMD_AVX2 static acc Accumulate(acc sum, reg a) {
+    return _mm256_add_pd(sum, a);
+  }
+  S21_SIMD_AVX2 static double Reduce(acc sum) {
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, sum);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  }
+  S21_SIMD_AVX2 static void Store(double *p, reg a) {
+    _mm256_storeu_pd(p, a);
+  }
+};
+
+// The kernels exist once per instruction set: a function can only inline
+// AVX2 intrinsics when it is compiled for AVX2 itself, so the bodies of the
+// Sse2 and Avx2 versions are the same and only the target differs
+template <typename T>
+const T *FindSse2(const T *first, const T *last, T value) noexcept {
+  using Ops = Sse2Ops<T>;
+  const auto needle = Ops::Set1(value);
+  for (; last - first >= Ops::kLanes; first += Ops::kLanes) {
+    unsigned mask = Ops::EqMask(Ops::Load(first), needle);
+    if (mask != 0) {
+      return first + __builtin_ctz(mask);
+    }
+  }
+  return FindScalar(first, last, value);
+}
+
+template <typename T>
+size_t CountSse2(const T *first, const T *last, T value) noexcept {
+  using Ops = Sse2Ops<T>;
+  const auto needle = Ops::Set1(value);
+  size_t result = 0;
+  for (; last - first >= Ops::kLanes; first += Ops::kLanes) {
+    result += __builtin_popcount(Ops::EqMask(Ops::Load(first), needle));
+  }
+  return result + CountScalar(first, last, value);
+}
+
+// Reduces to the extreme value first, then returns its first occurrence the
+// way std::min_element and std::max_element do
+template <typename T, bool kMin>
+const T *ExtremeSse2(const T *first, const T *last) noexcept {
+  using Ops = Sse2Ops<T>;
+  if (last - first < Ops::kLanes) {
+    return kMin ? MinScalar(first, last) : MaxScalar(first, last);
+  }
+  const T *it = first;
+  auto best = Ops::Load(it);
+  for (it += Ops::kLanes; last - it >= Ops::kLanes; it += Ops::kLanes) {
+    best = kMin ? Ops::Min(best, Ops::Load(it)) : Ops::Max(best, Ops::Load(it));
+  }
+  T lanes[Ops::kLanes];
+  Ops::Store(lanes, best);
+  T value = *(kMin ? MinScalar(lanes, lanes + Ops::kLanes)
+                   : MaxScalar(lanes, lanes + Ops::kLanes));
+  for (; it != last; ++it) {
+    if (kMin ? *it < value : value < *it) {
+      value = *it;
+    }
+  }
+  const T *found = FindSse2(first, last, value);
+  if (found == last) {
+    return kMin ? MinScalar(first, last) : MaxScalar(first, last);
+  }
+  return found;
+}
+
+template <typename T>
+sum_type<T> SumSse2(const T *first, const T *last) noexcept {
+  using Ops = Sse2Ops<T>;
+  auto total = Ops::Zero();
+  for (; last - first >= Ops::kLanes; first += Ops::kLanes) {
+    total = Ops::Accumulate(total, Ops::Load(first));
+  }
+  return Ops::Reduce(total) + SumScalar(first, last);
+}
+
+template <typename T>
+S21_SIMD_AVX2 const T *FindAvx2(const T *first, const T *last,
+                                T value) noexcept {
+  using Ops = Avx2Ops<T>;
+  const auto needle = Ops::Set1(value);
+  for (; last - first >= Ops::kLanes; first += Ops::kLanes) {
+    unsigned mask = Ops::EqMask(Ops::Load(first), needle);
+    if (mask != 0) {
+      return first + __builtin_ctz(mask);
+    }
+  }
+  return FindScalar(first, last, value);
+}
+
+template <typename T>
+S21_SIMD_AVX2 size_t CountAvx2(const T *first, const T *last,
+                               T value) noexcept {
+  using Ops = Avx2Ops<T>;
+  const auto needle = Ops::Set1(value);
+  size_t result = 0;
+  for (; last - first >= Ops::kLanes; first += Ops::kLanes) {
+    result += __builtin_popcount(Ops::EqMask(Ops::Load(first), needle));
+  }
+  return result + CountScalar(first, last, value);
+}
+
+template <typename T, bool kMin>
+S21_SIMD_AVX2 const T *ExtremeAvx2(const T *first, const T *last) noexcept {
+  using Ops = Avx2Ops<T>;
+  if (last - first < Ops::kLanes) {
+    return kMin ? MinScalar(first, last) : MaxScalar(first, last);
+  }
+  const T *it = first;
+  auto best = Ops::Load(it);
+  for (it += Ops::kLanes; last - it >= Ops::kLanes; it += Ops::kLanes) {
+    best = kMin ? Ops::Min(best, Ops::Load(it)) : Ops::Max(best, Ops::Load(it));
+  }
+  T lanes[Ops::kLanes];
+  Ops::Store(lanes, best);
+  T value = *(kMin ? MinScalar(lanes, lanes + Ops::kLanes)
+                   : MaxScalar(lanes, lanes + Ops::kLanes));
+  for (; it != last; ++it) {
+    if (kMin ? *it < value : value < *it) {
+      value = *it;
+    }
+  }
+  const T *found = FindAvx2(first, last, value);
+  if (found == last) {
+    return kMin ? MinScalar(first, last) : MaxScalar(first, last);
+  }
+  return found;
+}
+
+template <typename T>
+S21_SIMD_AVX2 sum_type<T> SumAvx2(const T *first, const T *last) noexcept {
+  using Ops = Avx2Ops<T>;
+  auto total = Ops::Zero();
+  for (; last - first >= Ops::kLanes; first += Ops::kLanes) {
+    total = Ops::Accumulate(total, Ops::Load(first));
+  }
+  return Ops::Reduce(total) + SumScalar(first, last);
+}
+#else
+template <typename T>
+constexpr bool kVectorized = false;
+#endif  // S21_SIMD_X86
+}  // namespace detail
+
+template <typename T>
+const T *find(const T *first, const T *last,
+              std::remove_cv_t<T> value) noexcept {
+#ifdef S21_SIMD_X86
+  if constexpr (detail::kVectorized<T>) {
+    return detail::HasAvx2() ? detail::FindAvx2(first, last, value)
+                             : detail::FindSse2(first, last, value);
+  }
+#endif
+  return detail::FindScalar(first, last, value);
+}
+
+template <typename T>
+size_t count(const T *first, const T *last,
+             std::remove_cv_t<T> value) noexcept {
+#ifdef S21_SIMD_X86
+  if constexpr (detail::kVectorized<T>) {
+    return detail::HasAvx2() ? detail::CountAvx2(first, last, value)
+                             : detail::CountSse2(first, last, value);
+  }
+#endif
+  return detail::CountScalar(first, last, value);
+}
+
+template <typename T>
+bool contains(const T *first, const T *last,
+              std::remove_cv_t<T> value) noexcept {
+  return find(first, last, value) != last;
+}
+
+template <typename T>
+const T *min_element(const T *first, const T *last) noexcept {
+#ifdef S21_SIMD_X86
+  if constexpr (detail::kVectorized<T>) {
+    return detail::HasAvx2() ? detail::ExtremeAvx2<T, true>(first, last)
+                             : detail::ExtremeSse2<T, true>(first, last);
+  }
+#endif
+  return detail::MinScalar(first, last);
+}
+
+template <typename T>
+const T *max_element(const T *first, const T *last) noexcept {
+#ifdef S21_SIMD_X86
+  if constexpr (detail::kVectorized<T>) {
+    return detail::HasAvx2() ? detail::ExtremeAvx2<T, false>(first, last)
+                             : detail::ExtremeSse2<T, false>(first, last);
+  }
+#endif
+  return detail::MaxScalar(first, last);
+}
+
+template <typename T>
+sum_type<T> sum(const T *first, const T *last) noexcept {
+#ifdef S21_SIMD_X86
+  if constexpr (detail::kVectorized<T>) {
+    return detail::HasAvx2() ? detail::SumAvx2(first, last)
+                             : detail::SumSse2(first, last);
+  }
+#endif
+  return detail::SumScalar(first, last);
+}
+}  // namespace simd
+}  // namespace s21
+
+#undef S21_SIMD_X86
+#undef S21_SIMD_AVX2
+
+#endif  // S21_CONTAINERS_SRC_S21_SIMD_H_
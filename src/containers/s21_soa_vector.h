@@ -0,0 +1,706 @@
+#ifndef S21_CONTAINERS_SRC_S21_SOA_VECTOR_H_
+#define S21_CONTAINERS_SRC_S21_SOA_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_growth_policy.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// A non-owning view of one column of an soa_vector
+template <typename T>
+class column_span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using iterator = T *;
+  using size_type = size_t;
+
+  column_span() noexcept = default;
+  column_span(T *data, size_type size) noexcept : data_(data), size_(size) {}
+
+  T *data() const noexcept { return data_; }
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+  iterator begin() const noexcept { return data_; }
+  iterator end() const noexcept { return data_ + size_; }
+  reference operator[](size_type pos) const noexcept { return data_[pos]; }
+
+ private:
+  T *data_ = nullptr;
+  size_type size_ = 0;
+};
+
+// A vector of records stored as a structure of arrays: every field Ts[i]
+// has its own contiguous array, so a loop over a few fields reads only
+// those columns and the compiler can vectorize it. Elements are added as
+// tuples or one value per field and read back through column<I>() or as
+// tuples of references. Growing relocates each column like s21::vector
+// does, with memcpy for trivially relocatable fields
+template <typename... Ts>
+class soa_vector {
+  static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one field");
+
+  template <bool kConst>
+  class ZipIterator;
+
+ public:
+  // Soa vector Member Type
+  using value_type = std::tuple<Ts...>;
+  using reference = std::tuple<Ts &...>;
+  using const_reference = std::tuple<const Ts &...>;
+  using iterator = ZipIterator<false>;
+  using const_iterator = ZipIterator<true>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  template <size_t I>
+  using column_type = std::tuple_element_t<I, value_type>;
+
+  // Soa vector Member functions
+  soa_vector() noexcept;
+  soa_vector(std::initializer_list<value_type> const &items);
+  soa_vector(const soa_vector &v);
+  soa_vector(soa_vector &&v) noexcept;
+  ~soa_vector();
+
+  soa_vector &operator=(const soa_vector &v);
+  soa_vector &operator=(soa_vector &&v) noexcept;
+
+  // Soa vector Element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) noexcept;
+  const_reference operator[](size_type pos) const noexcept;
+  reference front() noexcept;
+  const_reference front() const noexcept;
+  reference back() noexcept;
+  const_reference back() const noexcept;
+
+  // Soa vector columns
+  template <size_t I>
+  column_span<column_type<I>> column() noexcept;
+  template <size_t I>
+  column_span<const column_type<I>> column() const noexcept;
+
+  // Soa vector iterators, they yield tuples of references
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Soa vector capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+  size_type capacity() const noexcept;
+  void shrink_to_fit();
+  void resize(size_type count);
+
+  // Soa vector modifiers
+  void clear() noexcept;
+  void push_back(const value_type &value);
+  void push_back(value_type &&value);
+  void pop_back() noexcept;
+  void swap(soa_vector &other) noexcept;
+
+  // Takes one value per field
+  template <typename... Us>
+  reference emplace_back(Us &&...values);
+
+ private:
+  using Columns = std::tuple<Ts *...>;
+  using Indices = std::index_sequence_for<Ts...>;
+
+  template <size_t I>
+  static constexpr bool kNothrowRelocate =
+      is_trivially_relocatable_v<column_type<I>> ||
+      std::is_nothrow_move_constructible_v<column_type<I>>;
+
+  static constexpr size_type kLargestField = std::max({sizeof(Ts)...});
+
+  Columns columns_;
+  size_type size_;
+  size_type capacity_;
+
+  template <typename Tuple>
+  reference Append(Tuple &&values);
+  template <typename Builder>
+  void Reallocate(size_type capacity, Builder build, size_type built);
+  template <size_t... Is>
+  reference RefAt(size_type index, std::index_sequence<Is...>) const noexcept;
+
+  template <size_t I = 0>
+  static void Allocate(Columns &columns, size_type capacity);
+  template <size_t I = 0>
+  static void Deallocate(Columns &columns, size_type capacity) noexcept;
+  template <size_t I = 0, typename Tuple>
+  static void Construct(Columns &columns, size_type index, Tuple &&values);
+  template <size_t I = 0>
+  static void Destroy(Columns &columns, size_type first,
+                      size_type last) noexcept;
+  template <size_t I = 0>
+  void CopyThrowingColumns(Columns &dest) const;
+  template <size_t I = 0>
+  void RelocateNothrowColumns(Columns &dest) noexcept;
+  template <size_t I = 0>
+  void DestroyThrowingColumns() noexcept;
+};
+
+// Random access iterator over all columns at once. Dereferencing builds a
+// tuple of references, so structured bindings write through to the columns
+template <typename... Ts>
+template <bool kConst>
+class soa_vector<Ts...>::ZipIterator {
+ public:
+  template <bool>
+  friend class ZipIterator;
+  friend class soa_vector<Ts...>;
+
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::tuple<Ts...>;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::conditional_t<kConst, std::tuple<const Ts &...>,
+                                       std::tuple<Ts &...>>;
+  using pointer = void;
+
+  ZipIterator() = default;
+  template <bool kOtherConst,
+            typename = std::enable_if_t<kConst || !kOtherConst>>
+  ZipIterator(const ZipIterator<kOtherConst> &it)
+      : vector_(it.vector_), index_(it.index_) {}
+
+  reference operator*() const { return (*vector_)[index_]; }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  ZipIterator &operator++() {
+    ++index_;
+    return *this;
+  }
+
+  ZipIterator operator++(int) {
+    ZipIterator tmp = *this;
+    ++index_;
+    return tmp;
+  }
+
+  ZipIterator &operator--() {
+    --index_;
+    return *this;
+  }
+
+  ZipIterator operator--(int) {
+    ZipIterator tmp = *this;
+    --index_;
+    return tmp;
+  }
+
+  ZipIterator &operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+
+  ZipIterator &operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+  }
+
+  ZipIterator operator+(difference_type n) const {
+    ZipIterator tmp = *this;
+    return tmp += n;
+  }
+
+  friend ZipIterator operator+(difference_type n, const ZipIterator &it) {
+    return it + n;
+  }
+
+  ZipIterator operator-(difference_type n) const {
+    ZipIterator tmp = *this;
+    return tmp -= n;
+  }
+
+  template <bool kOtherConst>
+  difference_type operator-(const ZipIterator<kOtherConst> &other) const {
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  template <bool kOtherConst>
+  bool operator==(const ZipIterator<kOtherConst> &other) const {
+    return index_ == other.index_;
+  }
+  template <bool kOtherConst>
+  bool operator!=(const ZipIterator<kOtherConst> &other) const {
+    return index_ != other.index_;
+  }
+  template <bool kOtherConst>
+  bool operator<(const ZipIterator<kOtherConst> &other) const {
+    return index_ < other.index_;
+  }
+  template <bool kOtherConst>
+  bool operator>(const ZipIterator<kOtherConst> &other) const {
+    return index_ > other.index_;
+  }
+  template <bool kOtherConst>
+  bool operator<=(const ZipIterator<kOtherConst> &other) const {
+    return index_ <= other.index_;
+  }
+  template <bool kOtherConst>
+  bool operator>=(const ZipIterator<kOtherConst> &other) const {
+    return index_ >= other.index_;
+  }
+
+ private:
+  using Vector =
+      std::conditional_t<kConst, const soa_vector<Ts...>, soa_vector<Ts...>>;
+
+  ZipIterator(Vector *vector, size_type index)
+      : vector_(vector), index_(index) {}
+
+  Vector *vector_ = nullptr;
+  size_type index_ = 0;
+};
+
+// Soa vector Member functions
+template <typename... Ts>
+soa_vector<Ts...>::soa_vector() noexcept
+    : columns_(), size_(0), capacity_(0) {}
+
+template <typename... Ts>
+soa_vector<Ts...>::soa_vector(std::initializer_list<value_type> const &items)
+    : soa_vector() {
+  reserve(items.size());
+  for (const value_type &item : items) {
+    Append(item);
+  }
+}
+
+template <typename... Ts>
+soa_vector<Ts...>::soa_vector(const soa_vector &v) : soa_vector() {
+  reserve(v.size_);
+  for (size_type i = 0; i < v.size_; ++i) {
+    Append(v[i]);
+  }
+}
+
+template <typename... Ts>
+soa_vector<Ts...>::soa_vector(soa_vector &&v) noexcept
+    : columns_(std::exchange(v.columns_, Columns())),
+      size_(std::exchange(v.size_, 0)),
+      capacity_(std::exchange(v.capacity_, 0)) {}
+
+template <typename... Ts>
+soa_vector<Ts...>::~soa_vector() {
+  clear();
+  Deallocate(columns_, capacity_);
+}
+
+template <typename... Ts>
+soa_vector<Ts...> &soa_vector<Ts...>::operator=(const soa_vector &v) {
+  if (this != &v) {
+    soa_vector tmp(v);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename... Ts>
+soa_vector<Ts...> &soa_vector<Ts...>::operator=(soa_vector &&v) noexcept {
+  if (this != &v) {
+    soa_vector tmp(std::move(v));
+    swap(tmp);
+  }
+  return *this;
+}
+
+// Soa vector Element access
+template <typename... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("accessing soa_vector element out of range");
+  }
+  return (*this)[pos];
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::const_reference soa_vector<Ts...>::at(
+    size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("accessing soa_vector element out of range");
+  }
+  return (*this)[pos];
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::operator[](
+    size_type pos) noexcept {
+  return RefAt(pos, Indices());
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::const_reference soa_vector<Ts...>::operator[](
+    size_type pos) const noexcept {
+  return RefAt(pos, Indices());
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::front() noexcept {
+  return (*this)[0];
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::const_reference soa_vector<Ts...>::front()
+    const noexcept {
+  return (*this)[0];
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::back() noexcept {
+  return (*this)[size_ - 1];
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::const_reference soa_vector<Ts...>::back()
+    const noexcept {
+  return (*this)[size_ - 1];
+}
+
+// Soa vector columns
+template <typename... Ts>
+template <size_t I>
+column_span<typename soa_vector<Ts...>::template column_type<I>>
+soa_vector<Ts...>::column() noexcept {
+  return column_span<column_type<I>>(std::get<I>(columns_), size_);
+}
+
+template <typename... Ts>
+template <size_t I>
+column_span<const typename soa_vector<Ts...>::template column_type<I>>
+soa_vector<Ts...>::column() const noexcept {
+  return column_span<const column_type<I>>(std::get<I>(columns_), size_);
+}
+
+// Soa vector iterators
+template <typename... Ts>
+typename soa_vector<Ts...>::iterator soa_vector<Ts...>::begin() noexcept {
+  return iterator(this, 0);
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::const_iterator soa_vector<Ts...>::begin()
+    const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::const_iterator soa_vector<Ts...>::cbegin()
+    const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::iterator soa_vector<Ts...>::end() noexcept {
+  return iterator(this, size_);
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::const_iterator soa_vector<Ts...>::end()
+    const noexcept {
+  return const_iterator(this, size_);
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::const_iterator soa_vector<Ts...>::cend()
+    const noexcept {
+  return const_iterator(this, size_);
+}
+
+// Soa vector capacity
+template <typename... Ts>
+bool soa_vector<Ts...>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::size_type soa_vector<Ts...>::size()
+    const noexcept {
+  return size_;
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::size_type soa_vector<Ts...>::max_size()
+    const noexcept {
+  return std::numeric_limits<size_type>::max() / kLargestField / 2;
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("soa_vector size exceeds max_size");
+  }
+  if (size > capacity_) {
+    Reallocate(size, [](Columns &) {}, 0);
+  }
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::size_type soa_vector<Ts...>::capacity()
+    const noexcept {
+  return capacity_;
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::shrink_to_fit() {
+  if (capacity_ > size_) {
+    Reallocate(size_, [](Columns &) {}, 0);
+  }
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::resize(size_type count) {
+  if (count <= size_) {
+    Destroy(columns_, count, size_);
+    size_ = count;
+    return;
+  }
+  reserve(count);
+  while (size_ < count) {
+    Append(value_type());
+  }
+}
+
+// Soa vector modifiers
+template <typename... Ts>
+void soa_vector<Ts...>::clear() noexcept {
+  Destroy(columns_, 0, size_);
+  size_ = 0;
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::push_back(const value_type &value) {
+  Append(value);
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::push_back(value_type &&value) {
+  Append(std::move(value));
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::pop_back() noexcept {
+  --size_;
+  Destroy(columns_, size_, size_ + 1);
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::swap(soa_vector &other) noexcept {
+  std::swap(columns_, other.columns_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
+
+template <typename... Ts>
+template <typename... Us>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::emplace_back(
+    Us &&...values) {
+  static_assert(sizeof...(Us) == sizeof...(Ts),
+                "soa_vector::emplace_back takes one value per field");
+  return Append(std::forward_as_tuple(std::forward<Us>(values)...));
+}
+
+// Private functions
+// When the columns are full the new element is built in the new storage
+// before the old elements move, so values that point into the vector stay
+// valid while they are read
+template <typename... Ts>
+template <typename Tuple>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::Append(
+    Tuple &&values) {
+  if (size_ < capacity_) {
+    Construct(columns_, size_, std::forward<Tuple>(values));
+  } else {
+    if (size_ == max_size()) {
+      throw std::length_error("soa_vector size exceeds max_size");
+    }
+    size_type capacity = std::min(
+        golden_ratio_growth::next_capacity(capacity_, size_ + 1, kLargestField),
+        max_size());
+    Reallocate(
+        capacity,
+        [this, &values](Columns &fresh) {
+          Construct(fresh, size_, std::forward<Tuple>(values));
+        },
+        1);
+  }
+  ++size_;
+  return back();
+}
+
+// Moves the elements into columns of the given capacity. build constructs
+// the built elements that follow them in the new columns. Fields that
+// may throw while relocating are copied first, so a failure leaves the
+// vector as it was
+template <typename... Ts>
+template <typename Builder>
+void soa_vector<Ts...>::Reallocate(size_type capacity, Builder build,
+                                   size_type built) {
+  Columns fresh;
+  Allocate(fresh, capacity);
+  try {
+    build(fresh);
+  } catch (...) {
+    Deallocate(fresh, capacity);
+    throw;
+  }
+  try {
+    CopyThrowingColumns(fresh);
+  } catch (...) {
+    Destroy(fresh, size_, size_ + built);
+    Deallocate(fresh, capacity);
+    throw;
+  }
+  RelocateNothrowColumns(fresh);
+  DestroyThrowingColumns();
+  Deallocate(columns_, capacity_);
+  columns_ = fresh;
+  capacity_ = capacity;
+}
+
+template <typename... Ts>
+template <size_t... Is>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::RefAt(
+    size_type index, std::index_sequence<Is...>) const noexcept {
+  return reference(std::get<Is>(columns_)[index]...);
+}
+
+template <typename... Ts>
+template <size_t I>
+void soa_vector<Ts...>::Allocate(Columns &columns, size_type capacity) {
+  if constexpr (I < sizeof...(Ts)) {
+    std::get<I>(columns) =
+        capacity == 0 ? nullptr
+                      : std::allocator<column_type<I>>().allocate(capacity);
+    try {
+      Allocate<I + 1>(columns, capacity);
+    } catch (...) {
+      if (capacity != 0) {
+        std::allocator<column_type<I>>().deallocate(std::get<I>(columns),
+                                                    capacity);
+      }
+      throw;
+    }
+  }
+}
+
+template <typename... Ts>
+template <size_t I>
+void soa_vector<Ts...>::Deallocate(Columns &columns,
+                                   size_type capacity) noexcept {
+  if constexpr (I < sizeof...(Ts)) {
+    if (std::get<I>(columns) != nullptr) {
+      std::allocator<column_type<I>>().deallocate(std::get<I>(columns),
+                                                  capacity);
+    }
+    Deallocate<I + 1>(columns, capacity);
+  }
+}
+
+// Builds field I onwards of element index, unwinding the built fields when
+// a later one throws
+template <typename... Ts>
+template <size_t I, typename Tuple>
+void soa_vector<Ts...>::Construct(Columns &columns, size_type index,
+                                  Tuple &&values) {
+  if constexpr (I < sizeof...(Ts)) {
+    column_type<I> *slot = std::get<I>(columns) + index;
+    ::new (static_cast<void *>(slot))
+        column_type<I>(std::get<I>(std::forward<Tuple>(values)));
+    try {
+      Construct<I + 1>(columns, index, std::forward<Tuple>(values));
+    } catch (...) {
+      std::destroy_at(slot);
+      throw;
+    }
+  }
+}
+
+template <typename... Ts>
+template <size_t I>
+void soa_vector<Ts...>::Destroy(Columns &columns, size_type first,
+                                size_type last) noexcept {
+  if constexpr (I < sizeof...(Ts)) {
+    if constexpr (!std::is_trivially_destructible_v<column_type<I>>) {
+      std::destroy(std::get<I>(columns) + first, std::get<I>(columns) + last);
+    }
+    Destroy<I + 1>(columns, first, last);
+  }
+}
+
+template <typename... Ts>
+template <size_t I>
+void soa_vector<Ts...>::CopyThrowingColumns(Columns &dest) const {
+  if constexpr (I < sizeof...(Ts)) {
+    if constexpr (!kNothrowRelocate<I>) {
+      std::uninitialized_copy(std::get<I>(columns_),
+                              std::get<I>(columns_) + size_,
+                              std::get<I>(dest));
+      try {
+        CopyThrowingColumns<I + 1>(dest);
+      } catch (...) {
+        std::destroy(std::get<I>(dest), std::get<I>(dest) + size_);
+        throw;
+      }
+    } else {
+      CopyThrowingColumns<I + 1>(dest);
+    }
+  }
+}
+
+template <typename... Ts>
+template <size_t I>
+void soa_vector<Ts...>::RelocateNothrowColumns(Columns &dest) noexcept {
+  if constexpr (I < sizeof...(Ts)) {
+    using U = column_type<I>;
+    if constexpr (is_trivially_relocatable_v<U>) {
+      if (size_ != 0) {
+        std::memcpy(static_cast<void *>(std::get<I>(dest)),
+                    static_cast<const void *>(std::get<I>(columns_)),
+                    size_ * sizeof(U));
+      }
+    } else if constexpr (kNothrowRelocate<I>) {
+      std::uninitialized_move(std::get<I>(columns_),
+                              std::get<I>(columns_) + size_,
+                              std::get<I>(dest));
+      std::destroy(std::get<I>(columns_), std::get<I>(columns_) + size_);
+    }
+    RelocateNothrowColumns<I + 1>(dest);
+  }
+}
+
+template <typename... Ts>
+template <size_t I>
+void soa_vector<Ts...>::DestroyThrowingColumns() noexcept {
+  if constexpr (I < sizeof...(Ts)) {
+    if constexpr (!kNothrowRelocate<I>) {
+      std::destroy(std::get<I>(columns_), std::get<I>(columns_) + size_);
+    }
+    DestroyThrowingColumns<I + 1>();
+  }
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_SOA_VECTOR_H_
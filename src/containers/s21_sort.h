@@ -0,0 +1,594 @@
+#ifndef S21_CONTAINERS_SRC_S21_SORT_H_
+#define S21_CONTAINERS_SRC_S21_SORT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+namespace detail {
+struct IdentityKey {
+  template <typename U>
+  constexpr U &&operator()(U &&value) const noexcept {
+    return std::forward<U>(value);
+  }
+};
+}  // namespace detail
+
+// Pattern-defeating quicksort: median-of-3 (ninther on large ranges)
+// pivots, a partial insertion sort when a partition did not move anything,
+// a separate pass for runs equal to the pivot, and a fall back to heapsort
+// after log2(n) badly unbalanced partitions, so adversarial input stays
+// O(n log n). Not stable
+template <typename RandomIt, typename Compare = std::less<>>
+void sort(RandomIt first, RandomIt last, Compare comp = Compare());
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N,
+          typename Compare = std::less<>>
+void sort(vector<T, Allocator, GrowthPolicy, N> &v, Compare comp = Compare());
+
+// Sorts one chunk per thread with s21::sort, then merges the chunks pairwise
+// through a buffer of the same size. Every merge is split between all the
+// threads along its merge path, so no level runs on a single core. threads
+// of 0 means std::thread::hardware_concurrency(); small ranges and types
+// that may throw on move are sorted on the calling thread
+template <typename RandomIt, typename Compare = std::less<>>
+void parallel_sort(RandomIt first, RandomIt last, Compare comp = Compare(),
+                   unsigned threads = 0);
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N,
+          typename Compare = std::less<>>
+void parallel_sort(vector<T, Allocator, GrowthPolicy, N> &v,
+                   Compare comp = Compare(), unsigned threads = 0);
+
+// LSD radix sort on the key projected out of every element, one byte per
+// pass through a single scratch buffer. A pass is skipped when all keys
+// share its byte, so small keys in wide types cost few passes. Keys are
+// integers, float or double; floats order -0.0 before +0.0 and NaNs by
+// their sign past the infinities. Stable. key may also be a member pointer
+template <typename RandomIt, typename KeyFn = detail::IdentityKey>
+void radix_sort(RandomIt first, RandomIt last, KeyFn key = KeyFn());
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N,
+          typename KeyFn = detail::IdentityKey>
+void radix_sort(vector<T, Allocator, GrowthPolicy, N> &v, KeyFn key = KeyFn());
+
+namespace detail {
+constexpr ptrdiff_t kInsertionSortThreshold = 24;
+constexpr ptrdiff_t kNintherThreshold = 128;
+constexpr ptrdiff_t kPartialInsertionSortLimit = 8;
+constexpr ptrdiff_t kParallelSortMinChunk = ptrdiff_t(1) << 14;
+
+template <typename RandomIt, typename Compare>
+void InsertionSort(RandomIt begin, RandomIt end, Compare &comp) {
+  if (begin == end) {
+    return;
+  }
+  for (RandomIt cur = begin + 1; cur != end; ++cur) {
+    RandomIt sift = cur;
+    RandomIt sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      auto tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (sift != begin && comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+    }
+  }
+}
+
+// Needs an element before begin that is not greater than any in the range,
+// which stops the sift without a bounds check
+template <typename RandomIt, typename Compare>
+void UnguardedInsertionSort(RandomIt begin, RandomIt end, Compare &comp) {
+  if (begin == end) {
+    return;
+  }
+  for (RandomIt cur = begin + 1; cur != end; ++cur) {
+    RandomIt sift = cur;
+    RandomIt sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      auto tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+    }
+  }
+}
+
+// Gives up once more than kPartialInsertionSortLimit elements were moved
+template <typename RandomIt, typename Compare>
+bool PartialInsertionSort(RandomIt begin, RandomIt end, Compare &comp) {
+  if (begin == end) {
+    return true;
+  }
+  ptrdiff_t moved = 0;
+  for (RandomIt cur = begin + 1; cur != end; ++cur) {
+    RandomIt sift = cur;
+    RandomIt sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      auto tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (sift != begin && comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+      moved += cur - sift;
+    }
+    if (moved > kPartialInsertionSortLimit) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename RandomIt, typename Compare>
+void Sort2(RandomIt a, RandomIt b, Compare &comp) {
+  if (comp(*b, *a)) {
+    std::iter_swap(a, b);
+  }
+}
+
+template <typename RandomIt, typename Compare>
+void Sort3(RandomIt a, RandomIt b, RandomIt c, Compare &comp) {
+  Sort2(a, b, comp);
+  Sort2(b, c, comp);
+  Sort2(a, b, comp);
+}
+
+// Partitions around *begin into [< pivot] pivot [>= pivot]. The median
+// selection left guards on both sides, so the scans need no bounds checks.
+// The flag is set when no element had to be swapped
+template <typename RandomIt, typename Compare>
+std::pair<RandomIt, bool> PartitionRight(RandomIt begin, RandomIt end,
+                                         Compare &comp) {
+  auto pivot = std::move(*begin);
+  RandomIt first = begin;
+  RandomIt last = end;
+
+  while (comp(*++first, pivot)) {
+  }
+  if (first - 1 == begin) {
+    while (first < last && !comp(*--last, pivot)) {
+    }
+  } else {
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  bool already_partitioned = first >= last;
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (comp(*++first, pivot)) {
+    }
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  RandomIt pivot_pos = first - 1;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return {pivot_pos, already_partitioned};
+}
+
+// Used when the pivot equals the element before the range: puts everything
+// equal to it on the left, so runs of equal keys are done in one pass
+template <typename RandomIt, typename Compare>
+RandomIt PartitionLeft(RandomIt begin, RandomIt end, Compare &comp) {
+  auto pivot = std::move(*begin);
+  RandomIt first = begin;
+  RandomIt last = end;
+
+  while (comp(pivot, *--last)) {
+  }
+  if (last + 1 == end) {
+    while (first < last && !comp(pivot, *++first)) {
+    }
+  } else {
+    while (!comp(pivot, *++first)) {
+    }
+  }
+
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (comp(pivot, *--last)) {
+    }
+    while (!comp(pivot, *++first)) {
+    }
+  }
+
+  RandomIt pivot_pos = last;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return pivot_pos;
+}
+
+template <typename RandomIt, typename Compare>
+void PdqSortLoop(RandomIt begin, RandomIt end, Compare &comp, int bad_allowed,
+                 bool leftmost) {
+  while (true) {
+    ptrdiff_t size = end - begin;
+    if (size < kInsertionSortThreshold) {
+      if (leftmost) {
+        InsertionSort(begin, end, comp);
+      } else {
+        UnguardedInsertionSort(begin, end, comp);
+      }
+      return;
+    }
+
+    ptrdiff_t half = size / 2;
+    if (size > kNintherThreshold) {
+      Sort3(begin, begin + half, end - 1, comp);
+      Sort3(begin + 1, begin + (half - 1), end - 2, comp);
+      Sort3(begin + 2, begin + (half + 1), end - 3, comp);
+      Sort3(begin + (half - 1), begin + half, begin + (half + 1), comp);
+      std::iter_swap(begin, begin + half);
+    } else {
+      Sort3(begin + half, begin, end - 1, comp);
+    }
+
+    if (!leftmost && !comp(*(begin - 1), *begin)) {
+      begin = PartitionLeft(begin, end, comp) + 1;
+      continue;
+    }
+
+    auto [pivot_pos, already_partitioned] = PartitionRight(begin, end, comp);
+    ptrdiff_t left_size = pivot_pos - begin;
+    ptrdiff_t right_size = end - (pivot_pos + 1);
+
+    if (left_size < size / 8 || right_size < size / 8) {
+      if (--bad_allowed == 0) {
+        std::make_heap(begin, end, comp);
+        std::sort_heap(begin, end, comp);
+        return;
+      }
+      // Swaps a few elements around to break the pattern that produced the
+      // bad pivot
+      if (left_size >= kInsertionSortThreshold) {
+        std::iter_swap(begin, begin + left_size / 4);
+        std::iter_swap(pivot_pos - 1, pivot_pos - left_size / 4);
+        if (left_size > kNintherThreshold) {
+          std::iter_swap(begin + 1, begin + (left_size / 4 + 1));
+          std::iter_swap(begin + 2, begin + (left_size / 4 + 2));
+          std::iter_swap(pivot_pos - 2, pivot_pos - (left_size / 4 + 1));
+          std::iter_swap(pivot_pos - 3, pivot_pos - (left_size / 4 + 2));
+        }
+      }
+      if (right_size >= kInsertionSortThreshold) {
+        std::iter_swap(pivot_pos + 1, pivot_pos + (1 + right_size / 4));
+        std::iter_swap(end - 1, end - right_size / 4);
+        if (right_size > kNintherThreshold) {
+          std::iter_swap(pivot_pos + 2, pivot_pos + (2 + right_size / 4));
+          std::iter_swap(pivot_pos + 3, pivot_pos + (3 + right_size / 4));
+          std::iter_swap(end - 2, end - (1 + right_size / 4));
+          std::iter_swap(end - 3, end - (2 + right_size / 4));
+        }
+      }
+    } else if (already_partitioned &&
+               PartialInsertionSort(begin, pivot_pos, comp) &&
+               PartialInsertionSort(pivot_pos + 1, end, comp)) {
+      return;
+    }
+
+    PdqSortLoop(begin, pivot_pos, comp, bad_allowed, leftmost);
+    begin = pivot_pos + 1;
+    leftmost = false;
+  }
+}
+
+// Runs task(0) .. task(count - 1) on their own threads, the first one on the
+// calling thread, and rethrows the first exception after all have finished.
+// A task whose thread can not be started runs on the calling thread
+template <typename Task>
+void RunParallel(size_t count, const Task &task) {
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto guarded = [&](size_t index) {
+    try {
+      task(index);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  };
+
+  vector<std::thread> workers;
+  workers.reserve(count - 1);
+  for (size_t i = 1; i < count; ++i) {
+    try {
+      workers.emplace_back(guarded, i);
+    } catch (const std::system_error &) {
+      guarded(i);
+    }
+  }
+  guarded(0);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+// Number of elements of a that come first in the first diagonal outputs of
+// std::merge(a, a + a_size, b, b + b_size)
+template <typename InputIt, typename Compare>
+ptrdiff_t MergePathSplit(InputIt a, ptrdiff_t a_size, InputIt b,
+                         ptrdiff_t b_size, ptrdiff_t diagonal,
+                         Compare &comp) {
+  ptrdiff_t low = std::max<ptrdiff_t>(0, diagonal - b_size);
+  ptrdiff_t high = std::min(diagonal, a_size);
+  while (low < high) {
+    ptrdiff_t mid = low + (high - low) / 2;
+    if (comp(b[diagonal - mid - 1], a[mid])) {
+      high = mid;
+    } else {
+      low = mid + 1;
+    }
+  }
+  return low;
+}
+
+// Maps a key to unsigned bits whose order matches the order of the keys
+template <typename Key, typename = void>
+struct RadixKey;
+
+template <typename Key>
+struct RadixKey<Key, std::enable_if_t<std::is_integral_v<Key> &&
+                                      !std::is_same_v<Key, bool>>> {
+  using bits = std::make_unsigned_t<Key>;
+  static bits ToBits(Key key) noexcept {
+    bits result = static_cast<bits>(key);
+    if constexpr (std::is_signed_v<Key>) {
+      result = static_cast<bits>(result ^ (bits(1) << (sizeof(bits) * 8 - 1)));
+    }
+    return result;
+  }
+};
+
+// Negative floats have all their bits flipped, positive ones only the sign
+template <typename Key>
+struct RadixKey<Key, std::enable_if_t<std::is_floating_point_v<Key> &&
+                                      (sizeof(Key) == 4 || sizeof(Key) == 8)>> {
+  using bits = std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t>;
+  static bits ToBits(Key key) noexcept {
+    bits result;
+    std::memcpy(&result, &key, sizeof(result));
+    const bits sign = bits(1) << (sizeof(bits) * 8 - 1);
+    return (result & sign) ? ~result : (result | sign);
+  }
+};
+}  // namespace detail
+
+template <typename RandomIt, typename Compare>
+void sort(RandomIt first, RandomIt last, Compare comp) {
+  ptrdiff_t size = last - first;
+  int bad_allowed = 0;
+  while (size > 1) {
+    size >>= 1;
+    ++bad_allowed;
+  }
+  detail::PdqSortLoop(first, last, comp, bad_allowed, true);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N,
+          typename Compare>
+void sort(vector<T, Allocator, GrowthPolicy, N> &v, Compare comp) {
+  s21::sort(v.data(), v.data() + v.size(), comp);
+}
+
+template <typename RandomIt, typename Compare>
+void parallel_sort(RandomIt first, RandomIt last, Compare comp,
+                   unsigned threads) {
+  using value_type = typename std::iterator_traits<RandomIt>::value_type;
+  ptrdiff_t size = last - first;
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  // A power of two keeps every merge level pairing runs exactly
+  size_t chunks = 1;
+  while (chunks * 2 <= threads &&
+         size / static_cast<ptrdiff_t>(chunks * 2) >=
+             detail::kParallelSortMinChunk) {
+    chunks *= 2;
+  }
+  if (chunks == 1 || !std::is_nothrow_move_constructible_v<value_type>) {
+    s21::sort(first, last, comp);
+    return;
+  }
+
+  auto bound = [size, chunks](size_t index) {
+    return static_cast<ptrdiff_t>(size * index / chunks);
+  };
+  detail::RunParallel(chunks, [&](size_t i) {
+    s21::sort(first + bound(i), first + bound(i + 1), comp);
+  });
+
+  std::allocator<value_type> alloc;
+  value_type *buffer = alloc.allocate(size);
+  detail::RunParallel(chunks, [&](size_t i) {
+    std::uninitialized_move(first + bound(i), first + bound(i + 1),
+                            buffer + bound(i));
+  });
+
+  // Runs of chunks / runs chunks are merged pairwise, alternating between
+  // the buffer and the original range, with parts threads sharing every
+  // pair. All the merge path splits of a level are found before any element
+  // is moved, since moving out of a source changes what a search compares
+  struct MergePart {
+    ptrdiff_t low, mid, high, begin_diagonal, end_diagonal;
+    bool last;
+  };
+  vector<ptrdiff_t> splits(chunks);
+  bool in_buffer = true;
+  try {
+    for (size_t runs = chunks; runs > 1; runs /= 2) {
+      size_t parts = chunks / (runs / 2);
+      size_t width = chunks / runs;
+      auto part_of = [&](size_t task) {
+        size_t pair = task / parts;
+        size_t part = task % parts;
+        MergePart result;
+        result.low = bound(pair * 2 * width);
+        result.mid = bound((pair * 2 + 1) * width);
+        result.high = bound((pair * 2 + 2) * width);
+        result.begin_diagonal = (result.high - result.low) * part / parts;
+        result.end_diagonal = (result.high - result.low) * (part + 1) / parts;
+        result.last = part + 1 == parts;
+        return result;
+      };
+      auto merge_level = [&](auto src, auto dest) {
+        detail::RunParallel(chunks, [&](size_t task) {
+          MergePart p = part_of(task);
+          splits[task] = detail::MergePathSplit(
+              src + p.low, p.mid - p.low, src + p.mid, p.high - p.mid,
+              p.begin_diagonal, comp);
+        });
+        detail::RunParallel(chunks, [&](size_t task) {
+          MergePart p = part_of(task);
+          auto a = src + p.low;
+          auto b = src + p.mid;
+          ptrdiff_t a_begin = splits[task];
+          ptrdiff_t a_end = p.last ? p.mid - p.low : splits[task + 1];
+          std::merge(std::make_move_iterator(a + a_begin),
+                     std::make_move_iterator(a + a_end),
+                     std::make_move_iterator(b + (p.begin_diagonal - a_begin)),
+                     std::make_move_iterator(b + (p.end_diagonal - a_end)),
+                     dest + (p.low + p.begin_diagonal), comp);
+        });
+      };
+      if (in_buffer) {
+        merge_level(buffer, first);
+      } else {
+        merge_level(first, buffer);
+      }
+      in_buffer = !in_buffer;
+    }
+    if (in_buffer) {
+      detail::RunParallel(chunks, [&](size_t i) {
+        std::move(buffer + bound(i), buffer + bound(i + 1), first + bound(i));
+      });
+    }
+  } catch (...) {
+    std::destroy(buffer, buffer + size);
+    alloc.deallocate(buffer, size);
+    throw;
+  }
+  std::destroy(buffer, buffer + size);
+  alloc.deallocate(buffer, size);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N,
+          typename Compare>
+void parallel_sort(vector<T, Allocator, GrowthPolicy, N> &v, Compare comp,
+                   unsigned threads) {
+  s21::parallel_sort(v.data(), v.data() + v.size(), comp, threads);
+}
+
+template <typename RandomIt, typename KeyFn>
+void radix_sort(RandomIt first, RandomIt last, KeyFn key) {
+  using value_type = typename std::iterator_traits<RandomIt>::value_type;
+  using key_type = std::decay_t<
+      std::invoke_result_t<KeyFn &, const value_type &>>;
+  using radix_key = detail::RadixKey<key_type>;
+  using bits = typename radix_key::bits;
+  constexpr size_t kPasses = sizeof(bits);
+  constexpr size_t kBuckets = 256;
+
+  size_t size = last - first;
+  if (size < 2) {
+    return;
+  }
+  auto digits = [&key](const value_type &value) {
+    return radix_key::ToBits(std::invoke(key, value));
+  };
+
+  // One read of the input fills the histograms of every pass
+  size_t counts[kPasses][kBuckets] = {};
+  for (RandomIt it = first; it != last; ++it) {
+    bits value = digits(*it);
+    for (size_t pass = 0; pass < kPasses; ++pass) {
+      ++counts[pass][(value >> (pass * 8)) & 0xFF];
+    }
+  }
+
+  // Trivially copyable elements are only ever assigned into the buffer. The
+  // others are move constructed into it once, so every pass can assign, and
+  // the sort continues from the buffer
+  std::allocator<value_type> alloc;
+  value_type *buffer = alloc.allocate(size);
+  bool in_buffer = false;
+  if constexpr (!std::is_trivially_copyable_v<value_type>) {
+    try {
+      std::uninitialized_move(first, last, buffer);
+    } catch (...) {
+      alloc.deallocate(buffer, size);
+      throw;
+    }
+    in_buffer = true;
+  }
+  auto release = [&]() {
+    if constexpr (!std::is_trivially_copyable_v<value_type>) {
+      std::destroy(buffer, buffer + size);
+    }
+    alloc.deallocate(buffer, size);
+  };
+
+  try {
+    for (size_t pass = 0; pass < kPasses; ++pass) {
+      size_t *count = counts[pass];
+      if (std::find(count, count + kBuckets, size) != count + kBuckets) {
+        continue;
+      }
+      size_t offset = 0;
+      for (size_t bucket = 0; bucket < kBuckets; ++bucket) {
+        size_t bucket_size = count[bucket];
+        count[bucket] = offset;
+        offset += bucket_size;
+      }
+      auto scatter = [&](auto src, auto dest) {
+        for (size_t i = 0; i < size; ++i) {
+          size_t bucket = (digits(src[i]) >> (pass * 8)) & 0xFF;
+          dest[count[bucket]++] = std::move(src[i]);
+        }
+      };
+      if (in_buffer) {
+        scatter(buffer, first);
+      } else {
+        scatter(first, buffer);
+      }
+      in_buffer = !in_buffer;
+    }
+    if (in_buffer) {
+      std::move(buffer, buffer + size, first);
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+  release();
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N,
+          typename KeyFn>
+void radix_sort(vector<T, Allocator, GrowthPolicy, N> &v, KeyFn key) {
+  s21::radix_sort(v.data(), v.data() + v.size(), key);
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_SORT_H_
@@ -2,13 +2,93 @@
 #define S21_CONTAINERS_SRC_S21_VECTOR_H_
 
 #include <cstddef>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "s21_allocators.h"
+#include "s21_growth_policy.h"
+
 namespace s21 {
+// Marks types whose objects may be moved to another address with a plain
+// memcpy, leaving the source storage without running its destructor.
+// Specialize it for types such as handles or unique pointers
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+// Holds when Alloc builds and destroys T with plain placement new and
+// destructor calls, so raw memory operations may stand in for them
+template <typename Alloc, typename T, typename = void>
+struct allocator_has_custom_construct : std::false_type {};
+
+template <typename Alloc, typename T>
+struct allocator_has_custom_construct<
+    Alloc, T,
+    std::void_t<decltype(std::declval<Alloc &>().construct(
+        std::declval<T *>(), std::declval<T &&>()))>> : std::true_type {};
+
+template <typename Alloc, typename T, typename = void>
+struct allocator_has_custom_destroy : std::false_type {};
+
+template <typename Alloc, typename T>
+struct allocator_has_custom_destroy<
+    Alloc, T,
+    std::void_t<decltype(std::declval<Alloc &>().destroy(std::declval<T *>()))>>
+    : std::true_type {};
+
+// Holds when Alloc can resize a block with reallocate(p, old_n, new_n),
+// keeping its bytes, like s21::malloc_allocator
+template <typename Alloc, typename T, typename = void>
+struct allocator_has_reallocate : std::false_type {};
+
+template <typename Alloc, typename T>
+struct allocator_has_reallocate<
+    Alloc, T,
+    std::void_t<decltype(std::declval<Alloc &>().reallocate(
+        std::declval<T *>(), size_t(), size_t()))>> : std::true_type {};
+
+template <typename Alloc, typename T>
+inline constexpr bool allocator_uses_placement_new_v =
+    std::is_same_v<Alloc, std::allocator<T>> ||
+    (!allocator_has_custom_construct<Alloc, T>::value &&
+     !allocator_has_custom_destroy<Alloc, T>::value);
+
+// Raw storage for the first N elements of a vector, which lives inside the
+// vector object itself. Empty when N is 0, so plain vectors don't pay for it
+template <typename T, size_t N>
+class VectorInlineStorage {
+ protected:
+  T *InlineData() noexcept { return reinterpret_cast<T *>(buffer_); }
+
+ private:
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+};
+
 template <typename T>
-class vector {
+class VectorInlineStorage<T, 0> {
+ protected:
+  T *InlineData() noexcept { return nullptr; }
+};
+
+// N > 0 keeps up to N elements inline and only spills to the allocator
+// beyond that, see s21::small_vector
+template <typename T, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = golden_ratio_growth, size_t N = 0>
+class vector : private VectorInlineStorage<T, N> {
+  template <typename InputIt>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIt>::iterator_category,
+      std::input_iterator_tag>>;
+
  public:
   // Vector Member Type
   using value_type = T;
@@ -18,19 +98,54 @@ class vector {
   using const_iterator = const T *;
   using size_type = size_t;
   using difference_type = std::ptrdiff_t;
+  using allocator_type = Allocator;
 
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static_assert(std::is_same_v<typename alloc_traits::value_type, T>,
+                "allocator value_type must match the vector one");
+  static_assert(std::is_same_v<typename alloc_traits::pointer, T *>,
+                "allocators with fancy pointers are not supported");
+
+  static constexpr bool kPlainConstruct =
+      allocator_uses_placement_new_v<Allocator, T>;
+  static constexpr bool kMemcpyRelocation =
+      kPlainConstruct && is_trivially_relocatable_v<T>;
+  static constexpr bool kReallocRelocation =
+      kMemcpyRelocation && allocator_has_reallocate<Allocator, T>::value;
+  // an inline buffer can't change hands, its elements have to be moved
+  static constexpr bool kInlineMoveNoexcept =
+      N == 0 || std::is_nothrow_move_constructible_v<T>;
+  static constexpr bool kMoveAssignNoexcept =
+      kInlineMoveNoexcept &&
+      (alloc_traits::propagate_on_container_move_assignment::value ||
+       alloc_traits::is_always_equal::value);
+  // an inline buffer is swapped through move assignment
+  static constexpr bool kSwapNoexcept = N == 0 || kMoveAssignNoexcept;
+  // insertions up to this size build their elements on the stack while the
+  // buffer is reallocated
+  static constexpr size_t kGapScratchBytes = 256;
+
+ public:
   // Vector Member functions
-  vector() noexcept;
-  explicit vector(size_type n);
-  vector(std::initializer_list<value_type> const &items);
+  vector() noexcept(noexcept(Allocator()));
+  explicit vector(const Allocator &alloc) noexcept;
+  explicit vector(size_type n, const Allocator &alloc = Allocator());
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &alloc = Allocator());
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  vector(InputIt first, InputIt last, const Allocator &alloc = Allocator());
   vector(const vector &v);
-  vector(vector &&v) noexcept;
+  vector(vector &&v) noexcept(kInlineMoveNoexcept);
   ~vector();
 
   vector &operator=(const vector &v);
-  vector &operator=(vector &&v) noexcept;
+  vector &operator=(vector &&v) noexcept(kMoveAssignNoexcept);
   vector &operator=(std::initializer_list<value_type> const &items);
 
+  allocator_type get_allocator() const noexcept;
+
   // Vector Element access
   reference at(size_type pos);
   reference operator[](size_type pos);
@@ -47,18 +162,32 @@ class vector {
   // Vector capacity
   bool empty() noexcept;
   size_type size() noexcept;
-  size_type max_size() noexcept;
+  size_type max_size() const noexcept;
   void reserve(size_type size);
   size_type capacity() noexcept;
   void shrink_to_fit();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
 
   // Vector modifiers
   void clear() noexcept;
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
   void erase(iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  iterator unordered_erase(const_iterator pos);
+  template <typename Predicate>
+  size_type erase_if(Predicate pred);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
   void pop_back();
-  void swap(vector &other);
+  void swap(vector &other) noexcept(kSwapNoexcept);
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
 
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args);
@@ -66,334 +195,980 @@ class vector {
   template <typename... Args>
   void insert_many_back(Args &&...args);
 
- private:
-  // по золотому сечению 
-  static constexpr double kExpansionFactor = 1.618;
-  static const size_type kInitSize = 8;
-  
+  // Vector range modifiers
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void assign(InputIt first, InputIt last);
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  void append(const value_type *arr, size_type count);
 
+ private:
   T *arr_;
   size_t size_;
   size_t capacity_;
+  Allocator alloc_;
 
   void ExpandArray(size_type incoming_amount = 1);
-  void IncreaseCapacity();
+  size_type NextCapacity(size_type incoming_amount) const;
   void ReallocateArray(size_type capacity);
-  void CopyToArray(value_type *arr, size_type size);
+  void RelocateToArray(value_type *arr);
+
+  template <typename Construct>
+  iterator InsertGap(size_type index, size_type count, Construct construct);
+  template <typename Construct>
+  void ReallocateWithGap(size_type capacity, size_type index, size_type count,
+                         Construct construct);
+  template <typename Construct>
+  void ResizeWithGap(size_type capacity, size_type index, size_type count,
+                     Construct construct);
+  template <typename U>
+  bool PointsInside(const U &object) const noexcept;
   void CopyFromArray(const value_type *arr, size_type size);
+  void StealArray(vector &v) noexcept(kInlineMoveNoexcept);
+  void TakeArray(vector &v) noexcept(kInlineMoveNoexcept);
+  void ResetArray() noexcept;
+  bool IsInline() noexcept;
   void FreeArray();
+
+  template <typename... Args>
+  void ConstructElement(value_type *arr, Args &&...args);
+  template <typename InputIt>
+  void CopyConstruct(InputIt first, InputIt last, value_type *dest);
+  void ValueConstruct(value_type *dest, size_type count);
+  void FillConstruct(value_type *dest, size_type count, const_reference value);
+  void DestroyElements(value_type *first, value_type *last) noexcept;
+
+  void TransferRange(value_type *first, value_type *last, value_type *dest);
+  void RelocateRange(value_type *first, value_type *last, value_type *dest);
+  value_type *AllocateArray(size_type capacity);
+  void DeallocateArray(value_type *arr, size_type capacity) noexcept;
 };
 
 // Vector Member functions
-template <typename T>
-vector<T>::vector() noexcept : arr_(nullptr), size_(0), capacity_(0) {}
-
-template <typename T>
-vector<T>::vector(size_type n)
-    : arr_(new value_type[n]()), size_(n), capacity_(n) {}
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+vector<T, Allocator, GrowthPolicy, N>::vector() noexcept(noexcept(Allocator()))
+    : arr_(this->InlineData()), size_(0), capacity_(N), alloc_() {}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+vector<T, Allocator, GrowthPolicy, N>::vector(const Allocator &alloc) noexcept
+    : arr_(this->InlineData()), size_(0), capacity_(N), alloc_(alloc) {}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+vector<T, Allocator, GrowthPolicy, N>::vector(size_type n,
+                                              const Allocator &alloc)
+    : arr_(this->InlineData()), size_(0), capacity_(N), alloc_(alloc) {
+  reserve(n);
+  try {
+    ValueConstruct(arr_, n);
+  } catch (...) {
+    DeallocateArray(arr_, capacity_);
+    throw;
+  }
+  size_ = n;
+}
 
-template <typename T>
-vector<T>::vector(std::initializer_list<value_type> const &items) {
-  size_ = items.size();
-  capacity_ = size_;
-  arr_ = new value_type[size_];
-  CopyFromArray(items.begin(), items.size());
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+vector<T, Allocator, GrowthPolicy, N>::vector(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : arr_(this->InlineData()), size_(0), capacity_(N), alloc_(alloc) {
+  try {
+    CopyFromArray(items.begin(), items.size());
+  } catch (...) {
+    FreeArray();
+    DeallocateArray(arr_, capacity_);
+    throw;
+  }
 }
 
-template <typename T>
-vector<T>::vector(const vector &v) {
-  size_ = v.size_;
-  capacity_ = v.capacity_;
-  arr_ = new value_type[v.capacity_]();
-  CopyFromArray(v.arr_, v.size_);
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename InputIt, typename>
+vector<T, Allocator, GrowthPolicy, N>::vector(InputIt first, InputIt last,
+                                           const Allocator &alloc)
+    : arr_(this->InlineData()), size_(0), capacity_(N), alloc_(alloc) {
+  try {
+    assign(first, last);
+  } catch (...) {
+    FreeArray();
+    DeallocateArray(arr_, capacity_);
+    throw;
+  }
 }
 
-template <typename T>
-vector<T>::vector(vector &&v) noexcept {
-  size_ = v.size_;
-  capacity_ = v.capacity_;
-  arr_ = v.arr_;
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+vector<T, Allocator, GrowthPolicy, N>::vector(const vector &v)
+    : arr_(this->InlineData()),
+      size_(0),
+      capacity_(N),
+      alloc_(alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+  try {
+    CopyFromArray(v.arr_, v.size_);
+  } catch (...) {
+    FreeArray();
+    DeallocateArray(arr_, capacity_);
+    throw;
+  }
+}
 
-  v.size_ = 0;
-  v.capacity_ = 0;
-  v.arr_ = nullptr;
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+vector<T, Allocator, GrowthPolicy, N>::vector(
+    vector &&v) noexcept(kInlineMoveNoexcept)
+    : arr_(this->InlineData()),
+      size_(0),
+      capacity_(N),
+      alloc_(std::move(v.alloc_)) {
+  TakeArray(v);
 }
 
-template <typename T>
-vector<T>::~vector() {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+vector<T, Allocator, GrowthPolicy, N>::~vector() {
   FreeArray();
+  DeallocateArray(arr_, capacity_);
 }
 
-template <typename T>
-vector<T> &vector<T>::operator=(const vector<T> &v) {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+vector<T, Allocator, GrowthPolicy, N> &
+vector<T, Allocator, GrowthPolicy, N>::operator=(
+    const vector<T, Allocator, GrowthPolicy, N> &v) {
   if (this == &v) {
     return *this;
   }
-  clear();
-  reserve(v.size_);
-
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+    if (alloc_ != v.alloc_) {
+      FreeArray();
+      DeallocateArray(arr_, capacity_);
+      ResetArray();
+    }
+    alloc_ = v.alloc_;
+  }
   CopyFromArray(v.arr_, v.size_);
   return *this;
 }
 
-template <typename T>
-vector<T> &vector<T>::operator=(vector<T> &&v) noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+vector<T, Allocator, GrowthPolicy, N> &
+vector<T, Allocator, GrowthPolicy, N>::operator=(
+    vector<T, Allocator, GrowthPolicy, N> &&v) noexcept(kMoveAssignNoexcept) {
   if (this == &v) {
     return *this;
   }
-  FreeArray();
-
-  size_ = v.size_;
-  capacity_ = v.capacity_;
-  arr_ = v.arr_;
-
-  v.size_ = 0;
-  v.capacity_ = 0;
-  v.arr_ = nullptr;
+  if constexpr (kMoveAssignNoexcept) {
+    StealArray(v);
+  } else if (alloc_ == v.alloc_) {
+    StealArray(v);
+  } else {
+    // the buffer can't change hands, so the elements are moved one by one
+    assign(std::make_move_iterator(v.begin()),
+           std::make_move_iterator(v.end()));
+    v.clear();
+  }
   return *this;
 }
 
-template <typename T>
-vector<T> &vector<T>::operator=(
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+vector<T, Allocator, GrowthPolicy, N> &
+vector<T, Allocator, GrowthPolicy, N>::operator=(
     std::initializer_list<value_type> const &items) {
-  clear();
-  reserve(items.size());
   CopyFromArray(items.begin(), items.size());
   return *this;
 }
 
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::allocator_type
+vector<T, Allocator, GrowthPolicy, N>::get_allocator() const noexcept {
+  return alloc_;
+}
+
 // Vector Element access
-template <typename T>
-typename vector<T>::reference vector<T>::at(size_type pos) {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::reference
+vector<T, Allocator, GrowthPolicy, N>::at(size_type pos) {
   if (pos >= size_) {
     throw std::out_of_range("accessing vector element out of range");
   }
   return arr_[pos];
 }
 
-template <typename T>
-typename vector<T>::reference vector<T>::operator[](size_type pos) {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::reference
+vector<T, Allocator, GrowthPolicy, N>::operator[](size_type pos) {
   return arr_[pos];
 }
 
-template <typename T>
-typename vector<T>::const_reference vector<T>::front() {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::const_reference
+vector<T, Allocator, GrowthPolicy, N>::front() {
   return arr_[0];
 }
 
-template <typename T>
-typename vector<T>::const_reference vector<T>::back() {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::const_reference
+vector<T, Allocator, GrowthPolicy, N>::back() {
   return arr_[size_ - 1];
 }
 
-template <typename T>
-T *vector<T>::data() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+T *vector<T, Allocator, GrowthPolicy, N>::data() noexcept {
   return arr_;
 }
 
 // Vector iterators
-template <typename T>
-typename vector<T>::iterator vector<T>::begin() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::iterator
+vector<T, Allocator, GrowthPolicy, N>::begin() noexcept {
   return arr_;
 }
 
-template <typename T>
-typename vector<T>::const_iterator vector<T>::cbegin() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::const_iterator
+vector<T, Allocator, GrowthPolicy, N>::cbegin() const noexcept {
   return arr_;
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::end() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::iterator
+vector<T, Allocator, GrowthPolicy, N>::end() noexcept {
   return arr_ + size_;
 }
 
-template <typename T>
-typename vector<T>::const_iterator vector<T>::cend() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::const_iterator
+vector<T, Allocator, GrowthPolicy, N>::cend() const noexcept {
   return arr_ + size_;
 }
 
 // Vector capacity
-template <typename T>
-bool vector<T>::empty() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+bool vector<T, Allocator, GrowthPolicy, N>::empty() noexcept {
   return size_ == 0;
 }
 
-template <typename T>
-typename vector<T>::size_type vector<T>::size() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::size_type
+vector<T, Allocator, GrowthPolicy, N>::size() noexcept {
   return size_;
 }
 
-template <typename T>
-typename vector<T>::size_type vector<T>::max_size() noexcept {
-  return SIZE_MAX / sizeof(value_type);
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::size_type
+vector<T, Allocator, GrowthPolicy, N>::max_size() const noexcept {
+  return alloc_traits::max_size(alloc_);
 }
 
-template <typename T>
-void vector<T>::reserve(size_type size) {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::reserve(size_type size) {
   if (size <= capacity_) {
     return;
   }
-  auto expanded_arr = new value_type[size]();
-  CopyToArray(expanded_arr, size);
-  FreeArray();
-  arr_ = expanded_arr;
-  capacity_ = size;
+  ReallocateArray(size);
 }
 
-template <typename T>
-typename vector<T>::size_type vector<T>::capacity() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::size_type
+vector<T, Allocator, GrowthPolicy, N>::capacity() noexcept {
   return capacity_;
 }
 
-template <typename T>
-void vector<T>::shrink_to_fit() {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::shrink_to_fit() {
   ReallocateArray(size_);
 }
 
-// Vector modifiers
-template <typename T>
-void vector<T>::clear() noexcept {
-  size_ = 0;
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::resize(size_type count) {
+  if (count <= size_) {
+    erase(cbegin() + count, cend());
+    return;
+  }
+  InsertGap(size_, count - size_, [&](value_type *dest) {
+    ValueConstruct(dest, count - size_);
+  });
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::insert(iterator pos,
-                                               const_reference value) {
-  if (pos == end()) {
-    push_back(value);
-    pos = end();
-    return --pos;
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::resize(size_type count,
+                                                   const_reference value) {
+  if (count <= size_) {
+    erase(cbegin() + count, cend());
+    return;
   }
+  InsertGap(size_, count - size_, [&](value_type *dest) {
+    FillConstruct(dest, count - size_, value);
+  });
+}
 
-  difference_type diff = pos - begin();
+// Vector modifiers
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::clear() noexcept {
+  DestroyElements(arr_, arr_ + size_);
+  size_ = 0;
+}
 
-  ExpandArray();
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::iterator
+vector<T, Allocator, GrowthPolicy, N>::insert(iterator pos,
+                                              const_reference value) {
+  return emplace(pos, value);
+}
 
-  auto insert_pos = begin() + diff;
-  pos = insert_pos;
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::iterator
+vector<T, Allocator, GrowthPolicy, N>::insert(iterator pos,
+                                              value_type &&value) {
+  return emplace(pos, std::move(value));
+}
 
-  value_type evicted_item = *pos;
-  *pos = value;
-  pos++;
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename... Args>
+typename vector<T, Allocator, GrowthPolicy, N>::iterator
+vector<T, Allocator, GrowthPolicy, N>::emplace(const_iterator pos,
+                                               Args &&...args) {
+  size_type index = pos - cbegin();
+  if (index == size_) {
+    emplace_back(std::forward<Args>(args)...);
+    return begin() + index;
+  }
 
-  for (; pos <= end(); ++pos) {
-    std::swap(*pos, evicted_item);
+  if (size_ == capacity_) {
+    return InsertGap(index, 1, [&](value_type *dest) {
+      ConstructElement(dest, std::forward<Args>(args)...);
+    });
   }
-  ++size_;
-  return insert_pos;
+
+  // args may refer to an element that is about to be shifted
+  value_type item(std::forward<Args>(args)...);
+  return InsertGap(index, 1, [&](value_type *dest) {
+    ConstructElement(dest, std::move(item));
+  });
 }
 
-template <typename T>
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
 template <typename... Args>
-typename vector<T>::iterator vector<T>::insert_many(const_iterator pos,
-                                                    Args &&...args) {
-  difference_type diff = pos - begin();
+typename vector<T, Allocator, GrowthPolicy, N>::reference
+vector<T, Allocator, GrowthPolicy, N>::emplace_back(Args &&...args) {
+  if (size_ == capacity_) {
+    InsertGap(size_, 1, [&](value_type *dest) {
+      ConstructElement(dest, std::forward<Args>(args)...);
+    });
+  } else {
+    ConstructElement(arr_ + size_, std::forward<Args>(args)...);
+    ++size_;
+  }
+  return arr_[size_ - 1];
+}
 
-  ExpandArray(sizeof...(args));
+// All the values are built straight in the gap opened by a single shift of
+// the tail. Arguments that are elements of the vector itself are
+// materialized first, since the shift would move them away
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename... Args>
+typename vector<T, Allocator, GrowthPolicy, N>::iterator
+vector<T, Allocator, GrowthPolicy, N>::insert_many(const_iterator pos,
+                                                   Args &&...args) {
+  constexpr size_type count = sizeof...(args);
+  size_type index = pos - cbegin();
+  if (size_ + count <= capacity_ && (false || ... || PointsInside(args))) {
+    vector items(alloc_);
+    items.reserve(count);
+    (items.emplace_back(std::forward<Args>(args)), ...);
+    return InsertGap(index, count, [&](value_type *dest) {
+      CopyConstruct(std::make_move_iterator(items.begin()),
+                    std::make_move_iterator(items.end()), dest);
+    });
+  }
 
-  auto return_pos = begin() + diff;
+  return InsertGap(index, count, [&](value_type *dest) {
+    [[maybe_unused]] value_type *current = dest;
+    try {
+      ((ConstructElement(current, std::forward<Args>(args)), ++current), ...);
+    } catch (...) {
+      DestroyElements(dest, current);
+      throw;
+    }
+  });
+}
 
-  [[maybe_unused]] auto insert_pos = return_pos - 1;
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename... Args>
+void vector<T, Allocator, GrowthPolicy, N>::insert_many_back(Args &&...args) {
+  insert_many(cend(), std::forward<Args>(args)...);
+}
 
-  (insert(++insert_pos, value_type(std::forward<Args>(args))), ...);
-  return return_pos;
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::erase(iterator pos) {
+  erase(pos, pos + 1);
 }
 
-template <typename T>
-template <typename... Args>
-void vector<T>::insert_many_back(Args &&...args) {
-  ExpandArray(sizeof...(args));
-  (push_back(value_type(std::forward<Args>(args))), ...);
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::iterator
+vector<T, Allocator, GrowthPolicy, N>::erase(const_iterator first,
+                                             const_iterator last) {
+  auto erase_pos = begin() + (first - cbegin());
+  auto erase_end = begin() + (last - cbegin());
+  DestroyElements(erase_pos, erase_end);
+  RelocateRange(erase_end, end(), erase_pos);
+  size_ -= erase_end - erase_pos;
+  return erase_pos;
 }
 
-template <typename T>
-void vector<T>::erase(iterator pos) {
-  auto next = pos;
-  next++;
+// Fills the hole with the last element instead of shifting the tail, so the
+// order of the remaining elements is not kept
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::iterator
+vector<T, Allocator, GrowthPolicy, N>::unordered_erase(const_iterator pos) {
+  value_type *hole = arr_ + (pos - cbegin());
+  value_type *last = arr_ + size_ - 1;
+  if (hole == last) {
+    pop_back();
+  } else if constexpr (kMemcpyRelocation) {
+    alloc_traits::destroy(alloc_, hole);
+    RelocateRange(last, last + 1, hole);
+    --size_;
+  } else {
+    *hole = std::move(*last);
+    pop_back();
+  }
+  return hole;
+}
 
-  for (; next < end(); ++next, ++pos) {
-    std::swap(*next, *pos);
+// Moves the survivors down in one pass and destroys the leftover tail once,
+// unlike erase in a loop which shifts the tail for every removed element
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename Predicate>
+typename vector<T, Allocator, GrowthPolicy, N>::size_type
+vector<T, Allocator, GrowthPolicy, N>::erase_if(Predicate pred) {
+  value_type *first = arr_;
+  value_type *last = arr_ + size_;
+  while (first != last && !pred(std::as_const(*first))) {
+    ++first;
   }
-  --size_;
+  if (first == last) {
+    return 0;
+  }
+  value_type *dest = first;
+  for (++first; first != last; ++first) {
+    if (!pred(std::as_const(*first))) {
+      *dest = std::move(*first);
+      ++dest;
+    }
+  }
+  size_type removed = last - dest;
+  DestroyElements(dest, last);
+  size_ -= removed;
+  return removed;
 }
 
-template <typename T>
-void vector<T>::push_back(const_reference value) {
-  ExpandArray();
-  arr_[size_++] = value;
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::push_back(const_reference value) {
+  emplace_back(value);
 }
 
-template <typename T>
-void vector<T>::pop_back() {
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::pop_back() {
   --size_;
+  alloc_traits::destroy(alloc_, arr_ + size_);
 }
 
-template <typename T>
-void vector<T>::swap(vector &other) {
-  std::swap(*this, other);
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::swap(
+    vector &other) noexcept(kSwapNoexcept) {
+  if (IsInline() || other.IsInline()) {
+    vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+    return;
+  }
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(alloc_, other.alloc_);
+  }
+  std::swap(arr_, other.arr_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
 }
 
-template <typename T>
-void vector<T>::ExpandArray(size_type incoming_amount) {
-  if (capacity_ > size_ + incoming_amount) {
+// Vector range modifiers
+// Forward ranges are measured up front, so the storage is grown at most once
+// and the elements are copied in a single pass; use std::move_iterator to
+// move them instead. Input ranges are buffered first
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename InputIt, typename>
+void vector<T, Allocator, GrowthPolicy, N>::assign(InputIt first,
+                                                   InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  clear();
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    size_type count = std::distance(first, last);
+    reserve(count);
+    CopyConstruct(first, last, arr_);
+    size_ = count;
+  } else {
+    insert(cbegin(), first, last);
+  }
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename InputIt, typename>
+typename vector<T, Allocator, GrowthPolicy, N>::iterator
+vector<T, Allocator, GrowthPolicy, N>::insert(const_iterator pos, InputIt first,
+                                              InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  size_type index = pos - cbegin();
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    size_type count = std::distance(first, last);
+    return InsertGap(index, count, [&](value_type *dest) {
+      CopyConstruct(first, last, dest);
+    });
+  } else {
+    vector items(alloc_);
+    for (; first != last; ++first) {
+      items.emplace_back(*first);
+    }
+    return InsertGap(index, items.size_, [&](value_type *dest) {
+      CopyConstruct(std::make_move_iterator(items.begin()),
+                    std::make_move_iterator(items.end()), dest);
+    });
+  }
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::append(const value_type *arr,
+                                                   size_type count) {
+  InsertGap(size_, count, [&](value_type *dest) {
+    CopyConstruct(arr, arr + count, dest);
+  });
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::ExpandArray(
+    size_type incoming_amount) {
+  if (capacity_ >= size_ + incoming_amount) {
     return;
   }
 
-  if (capacity_ == 0) {
-    capacity_ = kInitSize;
+  ReallocateArray(NextCapacity(incoming_amount));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::size_type
+vector<T, Allocator, GrowthPolicy, N>::NextCapacity(
+    size_type incoming_amount) const {
+  if (incoming_amount > max_size() - size_) {
+    throw std::length_error("vector size exceeds max_size");
   }
+  return GrowthPolicy::next_capacity(capacity_, size_ + incoming_amount,
+                                     sizeof(value_type));
+}
 
-  while (capacity_ < (size_ + incoming_amount)) {
-    IncreaseCapacity();
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::ReallocateArray(
+    size_type capacity) {
+  if (capacity < size_) {
+    DestroyElements(arr_ + capacity, arr_ + size_);
+    size_ = capacity;
+  }
+  if constexpr (N > 0) {
+    if (capacity <= N) {
+      if (IsInline()) {
+        return;
+      }
+      capacity = N;
+    }
+  }
+  if constexpr (kReallocRelocation) {
+    if (arr_ != nullptr && capacity > N && !IsInline()) {
+      arr_ = alloc_.reallocate(arr_, capacity_, capacity);
+      capacity_ = capacity;
+      return;
+    }
   }
 
-  auto expanded_arr = new value_type[capacity_]();
-  CopyToArray(expanded_arr, capacity_);
-  FreeArray();
-  arr_ = expanded_arr;
+  auto reallocated_arr = AllocateArray(capacity);
+  try {
+    RelocateToArray(reallocated_arr);
+  } catch (...) {
+    DeallocateArray(reallocated_arr, capacity);
+    throw;
+  }
+  DeallocateArray(arr_, capacity_);
+  capacity_ = capacity;
+  arr_ = reallocated_arr;
 }
 
-template <typename T>
-void vector<T>::IncreaseCapacity() {
-  capacity_ = 1 + static_cast<size_type>(kExpansionFactor *
-                                         static_cast<double>(capacity_));
+// Opens a gap of count raw slots at index with one shift of the tail, or
+// builds the grown buffer with the gap already in place, and fills it with
+// construct(dest). construct must either build all count elements or
+// destroy the ones it has built before rethrowing
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename Construct>
+typename vector<T, Allocator, GrowthPolicy, N>::iterator
+vector<T, Allocator, GrowthPolicy, N>::InsertGap(size_type index,
+                                                 size_type count,
+                                                 Construct construct) {
+  if (count == 0) {
+    return begin() + index;
+  }
+  if (size_ + count > capacity_) {
+    ReallocateWithGap(NextCapacity(count), index, count, construct);
+    return begin() + index;
+  }
+
+  RelocateRange(arr_ + index, arr_ + size_, arr_ + index + count);
+  try {
+    construct(arr_ + index);
+  } catch (...) {
+    RelocateRange(arr_ + index + count, arr_ + size_ + count, arr_ + index);
+    throw;
+  }
+  size_ += count;
+  return begin() + index;
 }
 
-template <typename T>
-void vector<T>::ReallocateArray(size_type capacity) {
-  auto reallocatedArray = new value_type[capacity]();
-  CopyToArray(reallocatedArray, capacity);
-  FreeArray();
+// The new elements are constructed before the old ones are moved around
+// them, so construct may still read from the old storage
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename Construct>
+void vector<T, Allocator, GrowthPolicy, N>::ReallocateWithGap(
+    size_type capacity, size_type index, size_type count, Construct construct) {
+  if constexpr (kReallocRelocation) {
+    if (arr_ != nullptr && !IsInline()) {
+      ResizeWithGap(capacity, index, count, construct);
+      return;
+    }
+  }
+
+  auto expanded_arr = AllocateArray(capacity);
+  try {
+    construct(expanded_arr + index);
+  } catch (...) {
+    DeallocateArray(expanded_arr, capacity);
+    throw;
+  }
+
+  size_type transferred = 0;
+  try {
+    TransferRange(arr_, arr_ + index, expanded_arr);
+    transferred = index;
+    TransferRange(arr_ + index, arr_ + size_, expanded_arr + index + count);
+  } catch (...) {
+    DestroyElements(expanded_arr, expanded_arr + transferred);
+    DestroyElements(expanded_arr + index, expanded_arr + index + count);
+    DeallocateArray(expanded_arr, capacity);
+    throw;
+  }
+
+  if constexpr (!kMemcpyRelocation) {
+    DestroyElements(arr_, arr_ + size_);
+  }
+  DeallocateArray(arr_, capacity_);
+  arr_ = expanded_arr;
   capacity_ = capacity;
-  if (capacity_ < size_) {
-    size_ = capacity_;
+  size_ += count;
+}
+
+// Grows the heap buffer with the allocator's reallocate, so the old
+// elements are never copied by the vector. The new ones are built in a
+// scratch buffer first, as the old storage may be gone once the block moves.
+// Small insertions such as a push_back keep it on the stack
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename Construct>
+void vector<T, Allocator, GrowthPolicy, N>::ResizeWithGap(size_type capacity,
+                                                          size_type index,
+                                                          size_type count,
+                                                          Construct construct) {
+  alignas(value_type) unsigned char scratch[kGapScratchBytes];
+  const bool on_stack = count <= sizeof(scratch) / sizeof(value_type);
+  auto items = on_stack ? reinterpret_cast<value_type *>(scratch)
+                        : alloc_traits::allocate(alloc_, count);
+  auto release = [&] {
+    if (!on_stack) {
+      alloc_traits::deallocate(alloc_, items, count);
+    }
+  };
+  try {
+    construct(items);
+  } catch (...) {
+    release();
+    throw;
   }
-  arr_ = reallocatedArray;
+
+  try {
+    arr_ = alloc_.reallocate(arr_, capacity_, capacity);
+  } catch (...) {
+    DestroyElements(items, items + count);
+    release();
+    throw;
+  }
+  capacity_ = capacity;
+
+  RelocateRange(arr_ + index, arr_ + size_, arr_ + index + count);
+  std::memcpy(static_cast<void *>(arr_ + index),
+              static_cast<const void *>(items), count * sizeof(value_type));
+  release();
+  size_ += count;
 }
 
-template <typename T>
-void vector<T>::CopyToArray(value_type *arr, size_type size) {
-  for (size_type i = 0; i < size && i < size_; ++i) {
-    arr[i] = arr_[i];
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename U>
+bool vector<T, Allocator, GrowthPolicy, N>::PointsInside(
+    const U &object) const noexcept {
+  auto address = static_cast<const void *>(std::addressof(object));
+  std::less<const void *> less;
+  return !less(address, arr_) && less(address, arr_ + size_);
+}
+
+// Moves the live elements into the raw storage of arr and ends their
+// lifetime in arr_
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::RelocateToArray(value_type *arr) {
+  TransferRange(arr_, arr_ + size_, arr);
+  if constexpr (!kMemcpyRelocation) {
+    DestroyElements(arr_, arr_ + size_);
   }
 }
 
-template <typename T>
-void vector<T>::CopyFromArray(const value_type *arr, size_type size) {
+// Constructs [first, last) in the raw storage at dest without ending the
+// lifetime of the sources. Trivially relocatable types take a single memcpy
+// unless the allocator constructs them itself, the rest are moved when that
+// can't throw and copied otherwise, so a throwing copy leaves the sources
+// untouched
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::TransferRange(value_type *first,
+                                                          value_type *last,
+                                                          value_type *dest) {
+  if constexpr (kMemcpyRelocation) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first),
+                  (last - first) * sizeof(value_type));
+    }
+  } else if constexpr (std::is_nothrow_move_constructible_v<value_type> ||
+                       !std::is_copy_constructible_v<value_type>) {
+    CopyConstruct(std::make_move_iterator(first), std::make_move_iterator(last),
+                  dest);
+  } else {
+    CopyConstruct(first, last, dest);
+  }
+}
+
+// Moves [first, last) to dest within the same buffer, ending the lifetime
+// of the sources that are not overwritten. The ranges may overlap; trivially
+// relocatable types are shifted with a single memmove
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::RelocateRange(value_type *first,
+                                                          value_type *last,
+                                                          value_type *dest) {
+  if (first == last || first == dest) {
+    return;
+  }
+  if constexpr (kMemcpyRelocation) {
+    std::memmove(static_cast<void *>(dest), static_cast<const void *>(first),
+                 (last - first) * sizeof(value_type));
+  } else if (dest < first) {
+    for (; first != last; ++first, ++dest) {
+      ConstructElement(dest, std::move(*first));
+      alloc_traits::destroy(alloc_, first);
+    }
+  } else {
+    dest += last - first;
+    while (last != first) {
+      --last;
+      --dest;
+      ConstructElement(dest, std::move(*last));
+      alloc_traits::destroy(alloc_, last);
+    }
+  }
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::CopyFromArray(const value_type *arr,
+                                                          size_type size) {
   clear();
   if (capacity_ < size) {
     ReallocateArray(size);
   }
-  for (size_type i = 0; i < size; ++i) {
-    arr_[i] = arr[i];
-  }
+  CopyConstruct(arr, arr + size, arr_);
   size_ = size;
 }
 
-template <typename T>
-void vector<T>::FreeArray() {
-  delete[] arr_;
+// Takes over the buffer of v, whose allocator is equal to this one or is
+// propagated along with it
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::StealArray(
+    vector &v) noexcept(kInlineMoveNoexcept) {
+  FreeArray();
+  DeallocateArray(arr_, capacity_);
+  ResetArray();
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    alloc_ = std::move(v.alloc_);
+  }
+  TakeArray(v);
+}
+
+// Moves the contents of v into this empty vector: a heap buffer is stolen,
+// while inline elements are relocated into the own inline buffer
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::TakeArray(
+    vector &v) noexcept(kInlineMoveNoexcept) {
+  if (v.IsInline()) {
+    TransferRange(v.arr_, v.arr_ + v.size_, arr_);
+    size_ = v.size_;
+    v.clear();
+    return;
+  }
+
+  size_ = v.size_;
+  capacity_ = v.capacity_;
+  arr_ = v.arr_;
+  v.ResetArray();
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::ResetArray() noexcept {
+  arr_ = this->InlineData();
+  size_ = 0;
+  capacity_ = N;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+bool vector<T, Allocator, GrowthPolicy, N>::IsInline() noexcept {
+  return N > 0 && arr_ == this->InlineData();
 }
+
+// Destroys the live elements, the storage itself is released by
+// DeallocateArray
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::FreeArray() {
+  DestroyElements(arr_, arr_ + size_);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename... Args>
+void vector<T, Allocator, GrowthPolicy, N>::ConstructElement(value_type *arr,
+                                                             Args &&...args) {
+  alloc_traits::construct(alloc_, arr, std::forward<Args>(args)...);
+}
+
+// The range helpers build elements through the allocator and, like the
+// std::uninitialized_* algorithms they fall back to, destroy the ones
+// already built when a construction throws
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+template <typename InputIt>
+void vector<T, Allocator, GrowthPolicy, N>::CopyConstruct(InputIt first,
+                                                          InputIt last,
+                                                          value_type *dest) {
+  if constexpr (kPlainConstruct) {
+    std::uninitialized_copy(first, last, dest);
+  } else {
+    value_type *current = dest;
+    try {
+      for (; first != last; ++first, ++current) {
+        ConstructElement(current, *first);
+      }
+    } catch (...) {
+      DestroyElements(dest, current);
+      throw;
+    }
+  }
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::ValueConstruct(value_type *dest,
+                                                           size_type count) {
+  if constexpr (kPlainConstruct) {
+    std::uninitialized_value_construct_n(dest, count);
+  } else {
+    value_type *current = dest;
+    try {
+      for (; count != 0; --count, ++current) {
+        ConstructElement(current);
+      }
+    } catch (...) {
+      DestroyElements(dest, current);
+      throw;
+    }
+  }
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::FillConstruct(
+    value_type *dest, size_type count, const_reference value) {
+  if constexpr (kPlainConstruct) {
+    std::uninitialized_fill_n(dest, count, value);
+  } else {
+    value_type *current = dest;
+    try {
+      for (; count != 0; --count, ++current) {
+        ConstructElement(current, value);
+      }
+    } catch (...) {
+      DestroyElements(dest, current);
+      throw;
+    }
+  }
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::DestroyElements(
+    value_type *first, value_type *last) noexcept {
+  if constexpr (kPlainConstruct) {
+    std::destroy(first, last);
+  } else {
+    for (; first != last; ++first) {
+      alloc_traits::destroy(alloc_, first);
+    }
+  }
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<T, Allocator, GrowthPolicy, N>::value_type *
+vector<T, Allocator, GrowthPolicy, N>::AllocateArray(size_type capacity) {
+  if (capacity == 0) {
+    return nullptr;
+  }
+  if (capacity <= N && !IsInline()) {
+    return this->InlineData();
+  }
+  return alloc_traits::allocate(alloc_, capacity);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, size_t N>
+void vector<T, Allocator, GrowthPolicy, N>::DeallocateArray(
+    value_type *arr, size_type capacity) noexcept {
+  if (arr != nullptr && arr != this->InlineData()) {
+    alloc_traits::deallocate(alloc_, arr, capacity);
+  }
+}
+
+// A vector that keeps up to N elements inside the object and allocates only
+// when it grows past them
+template <typename T, size_t N, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = golden_ratio_growth>
+using small_vector = vector<T, Allocator, GrowthPolicy, N>;
+
+// A vector of at most N elements that lives entirely inside the object and
+// never allocates. Only the live elements are constructed; going past N
+// throws std::length_error and leaves the vector as it was
+template <typename T, size_t N>
+using static_vector =
+    vector<T, inline_only_allocator<T, N>, golden_ratio_growth, N>;
+
+// A vector whose buffer starts at an Alignment byte boundary, for aligned
+// SIMD loads
+template <typename T, size_t Alignment = cache_line_size>
+using aligned_vector = vector<T, aligned_allocator<T, Alignment>>;
+
+// A vector for large buffers of trivially relocatable elements. It grows
+// through realloc, which glibc turns into an mremap past its mmap threshold,
+// so the elements are never copied. Other element types fall back to the
+// usual allocate, move and free
+template <typename T, typename GrowthPolicy = golden_ratio_growth>
+using huge_vector = vector<T, malloc_allocator<T>, GrowthPolicy>;
 }  // namespace s21
 
+#include "s21_vector_bool.h"
+
 #endif  // SRC_S21_VECTOR_H_
\ No newline at end of file
@@ -0,0 +1,1176 @@
+#ifndef S21_CONTAINERS_SRC_S21_VECTOR_BOOL_H_
+#define S21_CONTAINERS_SRC_S21_VECTOR_BOOL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_growth_policy.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Bit-packed vector<bool>: elements are stored one bit each in 64-bit
+// words and accessed through proxy references. count, find, rank, select
+// and the bitwise operators work a whole word at a time. Bits past size()
+// are kept zero, so whole words can be compared and counted as they are.
+// N inline elements are rounded up to whole words
+template <typename Allocator, typename GrowthPolicy, size_t N>
+class vector<bool, Allocator, GrowthPolicy, N>
+    : private VectorInlineStorage<uint64_t, (N + 63) / 64> {
+  class BitReference;
+  template <bool kConst>
+  class BitIterator;
+
+  template <typename InputIt>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIt>::iterator_category,
+      std::input_iterator_tag>>;
+
+ public:
+  // Vector Member Type
+  using value_type = bool;
+  using reference = BitReference;
+  using const_reference = bool;
+  using iterator = BitIterator<false>;
+  using const_iterator = BitIterator<true>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using allocator_type = Allocator;
+  using word_type = uint64_t;
+
+  static constexpr size_type kWordBits = 64;
+  // returned by the searches when there is no such bit
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+ private:
+  using word_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<word_type>;
+  using alloc_traits = std::allocator_traits<word_allocator>;
+
+  static constexpr size_type kInlineWords = (N + 63) / 64;
+  static constexpr size_type kMaxBits = inline_only_capacity<Allocator>::value;
+  static constexpr bool kReallocWords =
+      allocator_has_reallocate<word_allocator, word_type>::value;
+  static constexpr bool kMoveAssignNoexcept =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+  // inline words are swapped through move assignment
+  static constexpr bool kSwapNoexcept =
+      kInlineWords == 0 || kMoveAssignNoexcept;
+
+ public:
+  // Vector Member functions
+  vector() noexcept(noexcept(Allocator()));
+  explicit vector(const Allocator &alloc) noexcept;
+  explicit vector(size_type n, bool value = false,
+                  const Allocator &alloc = Allocator());
+  vector(std::initializer_list<bool> const &items,
+         const Allocator &alloc = Allocator());
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  vector(InputIt first, InputIt last, const Allocator &alloc = Allocator());
+  vector(const vector &v);
+  vector(vector &&v) noexcept;
+  ~vector();
+
+  vector &operator=(const vector &v);
+  vector &operator=(vector &&v) noexcept(kMoveAssignNoexcept);
+  vector &operator=(std::initializer_list<bool> const &items);
+
+  allocator_type get_allocator() const noexcept;
+
+  // Vector Element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) noexcept;
+  const_reference operator[](size_type pos) const noexcept;
+  reference front() noexcept;
+  const_reference front() const noexcept;
+  reference back() noexcept;
+  const_reference back() const noexcept;
+  // The packed words, bit i of the vector is bit i % 64 of word i / 64
+  word_type *data() noexcept;
+  const word_type *data() const noexcept;
+
+  // Vector iterators
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Vector capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+  size_type capacity() const noexcept;
+  void shrink_to_fit();
+  void resize(size_type count, bool value = false);
+
+  // Vector modifiers
+  void clear() noexcept;
+  iterator insert(const_iterator pos, bool value);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  iterator unordered_erase(const_iterator pos);
+  template <typename Predicate>
+  size_type erase_if(Predicate pred);
+  void push_back(bool value);
+  void pop_back() noexcept;
+  void swap(vector &other) noexcept(kSwapNoexcept);
+  void flip() noexcept;
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+  // Vector range modifiers
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void assign(InputIt first, InputIt last);
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  void append(const bool *arr, size_type count);
+
+  // Vector bit queries
+  size_type count() const noexcept;
+  bool any() const noexcept;
+  bool none() const noexcept;
+  size_type find_first() const noexcept;
+  size_type find_next(size_type pos) const noexcept;
+  // Number of set bits in [0, pos)
+  size_type rank(size_type pos) const;
+  // Position of the set bit with the given rank, counting from 0
+  size_type select(size_type rank) const noexcept;
+
+  // Vector bitwise operations, both vectors must have the same size
+  vector &operator&=(const vector &other);
+  vector &operator|=(const vector &other);
+  vector &operator^=(const vector &other);
+
+ private:
+  word_type *words_;
+  size_type size_;
+  size_type capacity_;
+  word_allocator alloc_;
+
+  static size_type WordsFor(size_type bits) noexcept;
+  static word_type BitMask(size_type pos) noexcept;
+  static size_type PopCount(word_type word) noexcept;
+  static size_type CountTrailingZeros(word_type word) noexcept;
+
+  size_type NextCapacity(size_type incoming_amount) const;
+  void ReallocateWords(size_type capacity);
+  void CopyFromWords(const word_type *words, size_type size);
+  void FillBits(size_type first, size_type last, bool value) noexcept;
+  size_type FindFrom(size_type pos) const noexcept;
+  void CheckSameSize(const vector &other) const;
+  void StealWords(vector &v) noexcept;
+  void TakeWords(vector &v) noexcept;
+  void ResetWords() noexcept;
+  bool IsInline() const noexcept;
+  word_type *AllocateWords(size_type capacity);
+  void DeallocateWords(word_type *words, size_type capacity) noexcept;
+};
+
+// Proxy for a single bit, converts to bool and assigns through to its word
+template <typename Allocator, typename GrowthPolicy, size_t N>
+class vector<bool, Allocator, GrowthPolicy, N>::BitReference {
+ public:
+  BitReference(const BitReference &) noexcept = default;
+
+  BitReference &operator=(bool value) noexcept {
+    if (value) {
+      *word_ |= mask_;
+    } else {
+      *word_ &= ~mask_;
+    }
+    return *this;
+  }
+
+  BitReference &operator=(const BitReference &other) noexcept {
+    return *this = static_cast<bool>(other);
+  }
+
+  operator bool() const noexcept { return (*word_ & mask_) != 0; }
+  bool operator~() const noexcept { return (*word_ & mask_) == 0; }
+  void flip() noexcept { *word_ ^= mask_; }
+
+  friend void swap(BitReference a, BitReference b) noexcept {
+    bool tmp = a;
+    a = b;
+    b = tmp;
+  }
+
+ private:
+  friend class vector;
+
+  BitReference(word_type *word, word_type mask) noexcept
+      : word_(word), mask_(mask) {}
+
+  word_type *word_;
+  word_type mask_;
+};
+
+// Random access iterator over the bits, a word pointer plus a bit offset
+template <typename Allocator, typename GrowthPolicy, size_t N>
+template <bool kConst>
+class vector<bool, Allocator, GrowthPolicy, N>::BitIterator {
+  using WordPointer =
+      std::conditional_t<kConst, const word_type *, word_type *>;
+
+ public:
+  template <bool>
+  friend class BitIterator;
+  friend class vector;
+
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = bool;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::conditional_t<kConst, bool, BitReference>;
+  using pointer = void;
+
+  BitIterator() = default;
+  template <bool kOtherConst,
+            typename = std::enable_if_t<kConst || !kOtherConst>>
+  BitIterator(const BitIterator<kOtherConst> &it)
+      : word_(it.word_), offset_(it.offset_) {}
+
+  reference operator*() const {
+    if constexpr (kConst) {
+      return (*word_ >> offset_) & 1;
+    } else {
+      return BitReference(word_, word_type(1) << offset_);
+    }
+  }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  BitIterator &operator++() {
+    if (++offset_ == kWordBits) {
+      offset_ = 0;
+      ++word_;
+    }
+    return *this;
+  }
+
+  BitIterator operator++(int) {
+    BitIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  BitIterator &operator--() {
+    if (offset_-- == 0) {
+      offset_ = kWordBits - 1;
+      --word_;
+    }
+    return *this;
+  }
+
+  BitIterator operator--(int) {
+    BitIterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  BitIterator &operator+=(difference_type n) {
+    constexpr auto kBits = static_cast<difference_type>(kWordBits);
+    difference_type bit = static_cast<difference_type>(offset_) + n;
+    difference_type words = bit >= 0 ? bit / kBits : (bit - kBits + 1) / kBits;
+    word_ += words;
+    offset_ = static_cast<size_type>(bit - words * kBits);
+    return *this;
+  }
+
+  BitIterator &operator-=(difference_type n) { return *this += -n; }
+
+  BitIterator operator+(difference_type n) const {
+    BitIterator tmp = *this;
+    return tmp += n;
+  }
+
+  friend BitIterator operator+(difference_type n, const BitIterator &it) {
+    return it + n;
+  }
+
+  BitIterator operator-(difference_type n) const {
+    BitIterator tmp = *this;
+    return tmp -= n;
+  }
+
+  template <bool kOtherConst>
+  difference_type operator-(const BitIterator<kOtherConst> &other) const {
+    return (word_ - other.word_) * static_cast<difference_type>(kWordBits) +
+           static_cast<difference_type>(offset_) -
+           static_cast<difference_type>(other.offset_);
+  }
+
+  template <bool kOtherConst>
+  bool operator==(const BitIterator<kOtherConst> &other) const {
+    return word_ == other.word_ && offset_ == other.offset_;
+  }
+
+  template <bool kOtherConst>
+  bool operator!=(const BitIterator<kOtherConst> &other) const {
+    return !(*this == other);
+  }
+
+  template <bool kOtherConst>
+  bool operator<(const BitIterator<kOtherConst> &other) const {
+    return *this - other < 0;
+  }
+
+  template <bool kOtherConst>
+  bool operator>(const BitIterator<kOtherConst> &other) const {
+    return other < *this;
+  }
+
+  template <bool kOtherConst>
+  bool operator<=(const BitIterator<kOtherConst> &other) const {
+    return !(other < *this);
+  }
+
+  template <bool kOtherConst>
+  bool operator>=(const BitIterator<kOtherConst> &other) const {
+    return !(*this < other);
+  }
+
+ private:
+  BitIterator(WordPointer word, size_type offset) noexcept
+      : word_(word), offset_(offset) {}
+
+  WordPointer word_ = nullptr;
+  size_type offset_ = 0;
+};
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+bool operator==(const vector<bool, Allocator, GrowthPolicy, N> &lhs,
+                const vector<bool, Allocator, GrowthPolicy, N> &rhs) noexcept {
+  return lhs.size() == rhs.size() &&
+         std::equal(lhs.data(),
+                    lhs.data() + (lhs.size() + 63) / 64, rhs.data());
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+bool operator!=(const vector<bool, Allocator, GrowthPolicy, N> &lhs,
+                const vector<bool, Allocator, GrowthPolicy, N> &rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N> operator&(
+    vector<bool, Allocator, GrowthPolicy, N> lhs,
+    const vector<bool, Allocator, GrowthPolicy, N> &rhs) {
+  return lhs &= rhs;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N> operator|(
+    vector<bool, Allocator, GrowthPolicy, N> lhs,
+    const vector<bool, Allocator, GrowthPolicy, N> &rhs) {
+  return lhs |= rhs;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N> operator^(
+    vector<bool, Allocator, GrowthPolicy, N> lhs,
+    const vector<bool, Allocator, GrowthPolicy, N> &rhs) {
+  return lhs ^= rhs;
+}
+
+// Vector Member functions
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N>::vector() noexcept(
+    noexcept(Allocator()))
+    : vector(Allocator()) {}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N>::vector(
+    const Allocator &alloc) noexcept
+    : words_(nullptr), size_(0), capacity_(0), alloc_(alloc) {
+  ResetWords();
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N>::vector(size_type n, bool value,
+                                                 const Allocator &alloc)
+    : vector(alloc) {
+  resize(n, value);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N>::vector(
+    std::initializer_list<bool> const &items, const Allocator &alloc)
+    : vector(alloc) {
+  assign(items.begin(), items.end());
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+template <typename InputIt, typename>
+vector<bool, Allocator, GrowthPolicy, N>::vector(InputIt first, InputIt last,
+                                                 const Allocator &alloc)
+    : vector(alloc) {
+  assign(first, last);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N>::vector(const vector &v)
+    : vector(Allocator(
+          alloc_traits::select_on_container_copy_construction(v.alloc_))) {
+  CopyFromWords(v.words_, v.size_);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N>::vector(vector &&v) noexcept
+    : words_(nullptr), size_(0), capacity_(0), alloc_(std::move(v.alloc_)) {
+  ResetWords();
+  TakeWords(v);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N>::~vector() {
+  DeallocateWords(words_, capacity_);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N> &
+vector<bool, Allocator, GrowthPolicy, N>::operator=(const vector &v) {
+  if (this == &v) {
+    return *this;
+  }
+  if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+    if (alloc_ != v.alloc_) {
+      DeallocateWords(words_, capacity_);
+      ResetWords();
+    }
+    alloc_ = v.alloc_;
+  }
+  CopyFromWords(v.words_, v.size_);
+  return *this;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N> &
+vector<bool, Allocator, GrowthPolicy, N>::operator=(vector &&v) noexcept(
+    kMoveAssignNoexcept) {
+  if (this == &v) {
+    return *this;
+  }
+  if constexpr (kMoveAssignNoexcept) {
+    StealWords(v);
+  } else if (alloc_ == v.alloc_) {
+    StealWords(v);
+  } else {
+    CopyFromWords(v.words_, v.size_);
+    v.clear();
+  }
+  return *this;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N> &
+vector<bool, Allocator, GrowthPolicy, N>::operator=(
+    std::initializer_list<bool> const &items) {
+  assign(items.begin(), items.end());
+  return *this;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::allocator_type
+vector<bool, Allocator, GrowthPolicy, N>::get_allocator() const noexcept {
+  return allocator_type(alloc_);
+}
+
+// Vector Element access
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::reference
+vector<bool, Allocator, GrowthPolicy, N>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("accessing vector element out of range");
+  }
+  return (*this)[pos];
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::const_reference
+vector<bool, Allocator, GrowthPolicy, N>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("accessing vector element out of range");
+  }
+  return (*this)[pos];
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::reference
+vector<bool, Allocator, GrowthPolicy, N>::operator[](size_type pos) noexcept {
+  return reference(words_ + pos / kWordBits, BitMask(pos));
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::const_reference
+vector<bool, Allocator, GrowthPolicy, N>::operator[](
+    size_type pos) const noexcept {
+  return (words_[pos / kWordBits] & BitMask(pos)) != 0;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::reference
+vector<bool, Allocator, GrowthPolicy, N>::front() noexcept {
+  return (*this)[0];
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::const_reference
+vector<bool, Allocator, GrowthPolicy, N>::front() const noexcept {
+  return (*this)[0];
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::reference
+vector<bool, Allocator, GrowthPolicy, N>::back() noexcept {
+  return (*this)[size_ - 1];
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::const_reference
+vector<bool, Allocator, GrowthPolicy, N>::back() const noexcept {
+  return (*this)[size_ - 1];
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::word_type *
+vector<bool, Allocator, GrowthPolicy, N>::data() noexcept {
+  return words_;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+const typename vector<bool, Allocator, GrowthPolicy, N>::word_type *
+vector<bool, Allocator, GrowthPolicy, N>::data() const noexcept {
+  return words_;
+}
+
+// Vector iterators
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::iterator
+vector<bool, Allocator, GrowthPolicy, N>::begin() noexcept {
+  return iterator(words_, 0);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::const_iterator
+vector<bool, Allocator, GrowthPolicy, N>::begin() const noexcept {
+  return cbegin();
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::const_iterator
+vector<bool, Allocator, GrowthPolicy, N>::cbegin() const noexcept {
+  return const_iterator(words_, 0);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::iterator
+vector<bool, Allocator, GrowthPolicy, N>::end() noexcept {
+  return iterator(words_ + size_ / kWordBits, size_ % kWordBits);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::const_iterator
+vector<bool, Allocator, GrowthPolicy, N>::end() const noexcept {
+  return cend();
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::const_iterator
+vector<bool, Allocator, GrowthPolicy, N>::cend() const noexcept {
+  return const_iterator(words_ + size_ / kWordBits, size_ % kWordBits);
+}
+
+// Vector capacity
+template <typename Allocator, typename GrowthPolicy, size_t N>
+bool vector<bool, Allocator, GrowthPolicy, N>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::size() const noexcept {
+  return size_;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::max_size() const noexcept {
+  return std::min<size_type>(
+      std::min<size_type>(alloc_traits::max_size(alloc_), npos / kWordBits) *
+          kWordBits,
+      kMaxBits);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::reserve(size_type size) {
+  if (size <= capacity()) {
+    return;
+  }
+  if (size > max_size()) {
+    throw std::length_error("vector size exceeds max_size");
+  }
+  ReallocateWords(WordsFor(size));
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::capacity() const noexcept {
+  if constexpr (kMaxBits != SIZE_MAX) {
+    return std::min(capacity_ * kWordBits, kMaxBits);
+  } else {
+    return capacity_ * kWordBits;
+  }
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::shrink_to_fit() {
+  if (WordsFor(size_) < capacity_) {
+    ReallocateWords(WordsFor(size_));
+  }
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::resize(size_type count,
+                                                      bool value) {
+  if (count <= size_) {
+    FillBits(count, size_, false);
+  } else {
+    reserve(count);
+    FillBits(size_, count, value);
+  }
+  size_ = count;
+}
+
+// Vector modifiers
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::clear() noexcept {
+  std::fill(words_, words_ + WordsFor(size_), word_type(0));
+  size_ = 0;
+}
+
+// Bits after pos are shifted one at a time, so inserting is O(size)
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::iterator
+vector<bool, Allocator, GrowthPolicy, N>::insert(const_iterator pos,
+                                                 bool value) {
+  size_type index = pos - cbegin();
+  push_back(false);
+  std::copy_backward(begin() + index, end() - 1, end());
+  (*this)[index] = value;
+  return begin() + index;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::iterator
+vector<bool, Allocator, GrowthPolicy, N>::erase(const_iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::iterator
+vector<bool, Allocator, GrowthPolicy, N>::erase(const_iterator first,
+                                                const_iterator last) {
+  size_type index = first - cbegin();
+  size_type count = last - first;
+  std::copy(begin() + index + count, end(), begin() + index);
+  FillBits(size_ - count, size_, false);
+  size_ -= count;
+  return begin() + index;
+}
+
+// Moves the last bit into the hole instead of shifting the tail
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::iterator
+vector<bool, Allocator, GrowthPolicy, N>::unordered_erase(const_iterator pos) {
+  size_type index = pos - cbegin();
+  (*this)[index] = static_cast<bool>(back());
+  pop_back();
+  return begin() + index;
+}
+
+// Packs the surviving bits down in one pass and clears the tail once
+template <typename Allocator, typename GrowthPolicy, size_t N>
+template <typename Predicate>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::erase_if(Predicate pred) {
+  size_type dest = 0;
+  for (size_type pos = 0; pos < size_; ++pos) {
+    bool bit = (words_[pos / kWordBits] & BitMask(pos)) != 0;
+    if (!pred(bit)) {
+      (*this)[dest++] = bit;
+    }
+  }
+  size_type removed = size_ - dest;
+  FillBits(dest, size_, false);
+  size_ = dest;
+  return removed;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::push_back(bool value) {
+  if (size_ == capacity()) {
+    ReallocateWords(NextCapacity(1));
+  }
+  if (value) {
+    words_[size_ / kWordBits] |= BitMask(size_);
+  }
+  ++size_;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::pop_back() noexcept {
+  --size_;
+  words_[size_ / kWordBits] &= ~BitMask(size_);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::swap(vector &other) noexcept(
+    kSwapNoexcept) {
+  if (IsInline() || other.IsInline()) {
+    vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+    return;
+  }
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(alloc_, other.alloc_);
+  }
+  std::swap(words_, other.words_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::flip() noexcept {
+  size_type words = WordsFor(size_);
+  for (size_type i = 0; i < words; ++i) {
+    words_[i] = ~words_[i];
+  }
+  FillBits(size_, words * kWordBits, false);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+template <typename... Args>
+typename vector<bool, Allocator, GrowthPolicy, N>::iterator
+vector<bool, Allocator, GrowthPolicy, N>::emplace(const_iterator pos,
+                                                  Args &&...args) {
+  return insert(pos, bool(std::forward<Args>(args)...));
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+template <typename... Args>
+typename vector<bool, Allocator, GrowthPolicy, N>::reference
+vector<bool, Allocator, GrowthPolicy, N>::emplace_back(Args &&...args) {
+  push_back(bool(std::forward<Args>(args)...));
+  return back();
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+template <typename... Args>
+typename vector<bool, Allocator, GrowthPolicy, N>::iterator
+vector<bool, Allocator, GrowthPolicy, N>::insert_many(const_iterator pos,
+                                                      Args &&...args) {
+  if constexpr (sizeof...(Args) == 0) {
+    return begin() + (pos - cbegin());
+  } else {
+    bool items[] = {static_cast<bool>(std::forward<Args>(args))...};
+    return insert(pos, items, items + sizeof...(Args));
+  }
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+template <typename... Args>
+void vector<bool, Allocator, GrowthPolicy, N>::insert_many_back(
+    Args &&...args) {
+  reserve(size_ + sizeof...(Args));
+  (push_back(static_cast<bool>(std::forward<Args>(args))), ...);
+}
+
+// Forward ranges are measured up front, so the words are allocated once
+template <typename Allocator, typename GrowthPolicy, size_t N>
+template <typename InputIt, typename>
+void vector<bool, Allocator, GrowthPolicy, N>::assign(InputIt first,
+                                                      InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  clear();
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    reserve(std::distance(first, last));
+  }
+  for (; first != last; ++first) {
+    push_back(static_cast<bool>(*first));
+  }
+}
+
+// The range is appended and rotated into place, which shifts the bits
+// after pos once whatever the length of the range
+template <typename Allocator, typename GrowthPolicy, size_t N>
+template <typename InputIt, typename>
+typename vector<bool, Allocator, GrowthPolicy, N>::iterator
+vector<bool, Allocator, GrowthPolicy, N>::insert(const_iterator pos,
+                                                 InputIt first,
+                                                 InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  size_type index = pos - cbegin();
+  size_type old_size = size_;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    size_type count = std::distance(first, last);
+    if (count > max_size() - size_) {
+      throw std::length_error("vector size exceeds max_size");
+    }
+    reserve(size_ + count);
+  }
+  for (; first != last; ++first) {
+    push_back(static_cast<bool>(*first));
+  }
+  std::rotate(begin() + index, begin() + old_size, end());
+  return begin() + index;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::append(const bool *arr,
+                                                      size_type count) {
+  insert(cend(), arr, arr + count);
+}
+
+// Vector bit queries
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::count() const noexcept {
+  size_type result = 0;
+  size_type words = WordsFor(size_);
+  for (size_type i = 0; i < words; ++i) {
+    result += PopCount(words_[i]);
+  }
+  return result;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+bool vector<bool, Allocator, GrowthPolicy, N>::any() const noexcept {
+  return std::any_of(words_, words_ + WordsFor(size_),
+                     [](word_type word) { return word != 0; });
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+bool vector<bool, Allocator, GrowthPolicy, N>::none() const noexcept {
+  return !any();
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::find_first() const noexcept {
+  return FindFrom(0);
+}
+
+// The first set bit after pos
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::find_next(
+    size_type pos) const noexcept {
+  if (pos >= size_ || pos + 1 == size_) {
+    return npos;
+  }
+  return FindFrom(pos + 1);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::rank(size_type pos) const {
+  if (pos > size_) {
+    throw std::out_of_range("rank position is out of range");
+  }
+  size_type result = 0;
+  size_type words = pos / kWordBits;
+  for (size_type i = 0; i < words; ++i) {
+    result += PopCount(words_[i]);
+  }
+  if (pos % kWordBits != 0) {
+    result += PopCount(words_[words] & (BitMask(pos) - 1));
+  }
+  return result;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::select(
+    size_type rank) const noexcept {
+  size_type words = WordsFor(size_);
+  for (size_type i = 0; i < words; ++i) {
+    size_type ones = PopCount(words_[i]);
+    if (rank < ones) {
+      word_type word = words_[i];
+      for (; rank > 0; --rank) {
+        word &= word - 1;
+      }
+      return i * kWordBits + CountTrailingZeros(word);
+    }
+    rank -= ones;
+  }
+  return npos;
+}
+
+// Vector bitwise operations
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N> &
+vector<bool, Allocator, GrowthPolicy, N>::operator&=(const vector &other) {
+  CheckSameSize(other);
+  size_type words = WordsFor(size_);
+  for (size_type i = 0; i < words; ++i) {
+    words_[i] &= other.words_[i];
+  }
+  return *this;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N> &
+vector<bool, Allocator, GrowthPolicy, N>::operator|=(const vector &other) {
+  CheckSameSize(other);
+  size_type words = WordsFor(size_);
+  for (size_type i = 0; i < words; ++i) {
+    words_[i] |= other.words_[i];
+  }
+  return *this;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+vector<bool, Allocator, GrowthPolicy, N> &
+vector<bool, Allocator, GrowthPolicy, N>::operator^=(const vector &other) {
+  CheckSameSize(other);
+  size_type words = WordsFor(size_);
+  for (size_type i = 0; i < words; ++i) {
+    words_[i] ^= other.words_[i];
+  }
+  return *this;
+}
+
+// Vector helpers
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::WordsFor(size_type bits) noexcept {
+  return bits / kWordBits + (bits % kWordBits != 0);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::word_type
+vector<bool, Allocator, GrowthPolicy, N>::BitMask(size_type pos) noexcept {
+  return word_type(1) << (pos % kWordBits);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::PopCount(word_type word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_popcountll(static_cast<unsigned long long>(word));
+#else
+  size_type ones = 0;
+  for (; word != 0; word &= word - 1) {
+    ++ones;
+  }
+  return ones;
+#endif
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::CountTrailingZeros(
+    word_type word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(static_cast<unsigned long long>(word));
+#else
+  size_type zeros = 0;
+  for (; (word & 1) == 0; word >>= 1) {
+    ++zeros;
+  }
+  return zeros;
+#endif
+}
+
+// The growth policy works in words
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::NextCapacity(
+    size_type incoming_amount) const {
+  if (incoming_amount > max_size() - size_) {
+    throw std::length_error("vector size exceeds max_size");
+  }
+  return GrowthPolicy::next_capacity(
+      capacity_, WordsFor(size_ + incoming_amount), sizeof(word_type));
+}
+
+// Moves the words in use into storage of the given number of words and
+// zeroes the rest of it
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::ReallocateWords(
+    size_type capacity) {
+  if constexpr (kInlineWords > 0) {
+    if (capacity <= kInlineWords) {
+      if (IsInline()) {
+        return;
+      }
+      capacity = kInlineWords;
+    }
+  }
+  size_type used = WordsFor(size_);
+  if constexpr (kReallocWords) {
+    if (words_ != nullptr && capacity > kInlineWords && !IsInline()) {
+      words_ = alloc_.reallocate(words_, capacity_, capacity);
+      std::fill(words_ + used, words_ + capacity, word_type(0));
+      capacity_ = capacity;
+      return;
+    }
+  }
+
+  word_type *words = AllocateWords(capacity);
+  std::copy(words_, words_ + used, words);
+  std::fill(words + used, words + capacity, word_type(0));
+  DeallocateWords(words_, capacity_);
+  words_ = words;
+  capacity_ = capacity;
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::CopyFromWords(
+    const word_type *words, size_type size) {
+  clear();
+  reserve(size);
+  std::copy(words, words + WordsFor(size), words_);
+  size_ = size;
+}
+
+// Sets or clears the bits in [first, last) a word at a time
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::FillBits(size_type first,
+                                                        size_type last,
+                                                        bool value) noexcept {
+  if (first >= last) {
+    return;
+  }
+  auto apply = [value](word_type &word, word_type mask) {
+    word = value ? word | mask : word & ~mask;
+  };
+  size_type first_word = first / kWordBits;
+  size_type last_word = (last - 1) / kWordBits;
+  word_type head = ~word_type(0) << (first % kWordBits);
+  word_type tail = ~word_type(0) >> (kWordBits - 1 - (last - 1) % kWordBits);
+  if (first_word == last_word) {
+    apply(words_[first_word], head & tail);
+    return;
+  }
+  apply(words_[first_word], head);
+  std::fill(words_ + first_word + 1, words_ + last_word,
+            value ? ~word_type(0) : word_type(0));
+  apply(words_[last_word], tail);
+}
+
+// Bits past size_ are zero, so the scan stops at the last word in use
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::size_type
+vector<bool, Allocator, GrowthPolicy, N>::FindFrom(
+    size_type pos) const noexcept {
+  size_type words = WordsFor(size_);
+  size_type index = pos / kWordBits;
+  if (index >= words) {
+    return npos;
+  }
+  word_type word = words_[index] & (~word_type(0) << (pos % kWordBits));
+  while (word == 0) {
+    if (++index == words) {
+      return npos;
+    }
+    word = words_[index];
+  }
+  return index * kWordBits + CountTrailingZeros(word);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::CheckSameSize(
+    const vector &other) const {
+  if (size_ != other.size_) {
+    throw std::invalid_argument("bitwise operands differ in size");
+  }
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::StealWords(vector &v) noexcept {
+  DeallocateWords(words_, capacity_);
+  ResetWords();
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    alloc_ = std::move(v.alloc_);
+  }
+  TakeWords(v);
+}
+
+// Moves the contents of v into this empty vector: heap words are stolen,
+// inline ones are copied into the own inline buffer
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::TakeWords(vector &v) noexcept {
+  if (v.IsInline()) {
+    std::copy(v.words_, v.words_ + WordsFor(v.size_), words_);
+    size_ = v.size_;
+    v.clear();
+    return;
+  }
+
+  words_ = v.words_;
+  size_ = v.size_;
+  capacity_ = v.capacity_;
+  v.ResetWords();
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::ResetWords() noexcept {
+  words_ = this->InlineData();
+  size_ = 0;
+  capacity_ = kInlineWords;
+  std::fill(words_, words_ + kInlineWords, word_type(0));
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+bool vector<bool, Allocator, GrowthPolicy, N>::IsInline() const noexcept {
+  return kInlineWords > 0 &&
+         words_ == const_cast<vector *>(this)->InlineData();
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+typename vector<bool, Allocator, GrowthPolicy, N>::word_type *
+vector<bool, Allocator, GrowthPolicy, N>::AllocateWords(size_type capacity) {
+  if (capacity == 0) {
+    return nullptr;
+  }
+  if (capacity <= kInlineWords && !IsInline()) {
+    return this->InlineData();
+  }
+  return alloc_traits::allocate(alloc_, capacity);
+}
+
+template <typename Allocator, typename GrowthPolicy, size_t N>
+void vector<bool, Allocator, GrowthPolicy, N>::DeallocateWords(
+    word_type *words, size_type capacity) noexcept {
+  if (words != nullptr && words != this->InlineData()) {
+    alloc_traits::deallocate(alloc_, words, capacity);
+  }
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_VECTOR_BOOL_H_
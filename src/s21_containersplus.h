@@ -2,6 +2,15 @@
 #define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H_
 
 #include "containers/s21_array.h"
+#include "containers/s21_concurrent_vector.h"
+#include "containers/s21_cow_vector.h"
+#include "containers/s21_mdarray.h"
+#include "containers/s21_mmap_vector.h"
 #include "containers/s21_multiset.h"
+#include "containers/s21_segmented_vector.h"
+#include "containers/s21_serialize.h"
+#include "containers/s21_simd.h"
+#include "containers/s21_soa_vector.h"
+#include "containers/s21_sort.h"
 
 #endif  // S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H_
@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
 #include <iostream>
+#include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "../containers/s21_array.h"
 
@@ -156,4 +160,162 @@ TEST(TestArray, ArrayFill) {
   for (size_t i = 0; i < 5; i++) {
     EXPECT_EQ(arr[i], fillValue);
   }
-}
\ No newline at end of file
+}
+namespace {
+constexpr s21::array<uint32_t, 256> MakeCrcTable() {
+  s21::array<uint32_t, 256> table{};
+  for (uint32_t byte = 0; byte < 256; ++byte) {
+    uint32_t crc = byte;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+    }
+    table[byte] = crc;
+  }
+  return table;
+}
+
+constexpr s21::array<int, 4> Reversed(s21::array<int, 4> arr) {
+  s21::array<int, 4> result = arr;
+  for (size_t i = 0; i < arr.size(); ++i) result.at(i) = arr[3 - i];
+  return result;
+}
+
+constexpr s21::array<int, 4> SwappedAndFilled() {
+  s21::array<int, 4> lhs = {1, 2, 3, 4};
+  s21::array<int, 4> rhs{};
+  lhs.swap(rhs);
+  rhs = std::move(lhs);
+  lhs.fill(7);
+  return lhs;
+}
+
+constexpr auto kCrcTable = MakeCrcTable();
+}  // namespace
+
+TEST(TestArray, ConstexprLookupTable) {
+  static_assert(kCrcTable[0] == 0);
+  static_assert(kCrcTable[1] == 0x77073096u);
+  static_assert(kCrcTable.back() == 0x2D02EF8Du);
+  static_assert(kCrcTable.at(128) == 0xEDB88320u);
+  uint32_t crc = 0xFFFFFFFFu;
+  for (char c : std::string("123456789")) {
+    crc = kCrcTable[(crc ^ static_cast<uint8_t>(c)) & 0xFF] ^ (crc >> 8);
+  }
+  EXPECT_EQ(0xCBF43926u, crc ^ 0xFFFFFFFFu);
+}
+
+TEST(TestArray, ConstexprMembers) {
+  constexpr s21::array<int, 4> arr = {1, 2, 3, 4};
+  constexpr s21::array<int, 4> reversed = Reversed(arr);
+  static_assert(reversed.front() == 4 && reversed.back() == 1);
+  constexpr s21::array<int, 4> filled = SwappedAndFilled();
+  static_assert(filled[0] == 7 && filled[3] == 7);
+  static_assert(*(arr.end() - 1) == 4);
+  EXPECT_EQ(2, reversed[2]);
+  EXPECT_THROW(reversed.at(4), std::out_of_range);
+}
+
+TEST(TestArray, ComparisonOperators) {
+  constexpr s21::array<int, 3> small = {1, 2, 3};
+  constexpr s21::array<int, 3> large = {1, 3, 0};
+  static_assert(small == small && small != large);
+  static_assert(small < large && large > small);
+  static_assert(small <= small && large >= small);
+  s21::array<std::string, 2> words = {"a", "b"};
+  s21::array<std::string, 2> other = {"a", "c"};
+  EXPECT_TRUE(words < other);
+  EXPECT_FALSE(words == other);
+  other[1] = "b";
+  EXPECT_TRUE(words == other);
+  EXPECT_TRUE(words >= other);
+}
+
+TEST(TestArray, AlignedArray) {
+  s21::aligned_array<float, 10, 32> arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(arr.begin()) % 32);
+  EXPECT_EQ(32u, alignof(decltype(arr)));
+  s21::aligned_array<float, 10, 32> copy = arr;
+  EXPECT_TRUE(copy == arr);
+  s21::aligned_array<int64_t, 3> lines[2];
+  for (auto& line : lines) {
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(line.begin()) %
+                      s21::cache_line_size);
+  }
+}
+
+TEST(TestArray, PaddedArrayElementsOwnCacheLines) {
+  s21::padded_array<int, 4> counters{};
+  EXPECT_EQ(4 * s21::cache_line_size, sizeof(counters));
+  for (size_t i = 0; i < counters.size(); ++i) {
+    EXPECT_EQ(0, counters[i]);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(&counters[i]) %
+                      s21::cache_line_size);
+  }
+  counters.fill(2);
+  counters.front() = 1;
+  counters.at(3) = 5;
+  EXPECT_THROW(counters.at(4), std::out_of_range);
+  int sum = 0;
+  for (int value : counters) sum += value;
+  EXPECT_EQ(10, sum);
+  const auto& cref = counters;
+  EXPECT_EQ(4, cref.end() - cref.begin());
+  EXPECT_EQ(5, cref.back());
+  auto it = counters.begin() + 2;
+  EXPECT_EQ(2, it[-1]);
+  EXPECT_TRUE(it > counters.cbegin());
+}
+
+TEST(TestArray, PaddedArrayAcrossThreads) {
+  constexpr int kThreads = 4;
+  s21::padded_array<int64_t, kThreads> counters{};
+  std::vector<std::thread> workers;
+  for (int t = 0; t < kThreads; ++t) {
+    workers.emplace_back([&counters, t] {
+      for (int i = 0; i < 100000; ++i) ++counters[t];
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  for (int64_t count : counters) EXPECT_EQ(100000, count);
+}
+
+TEST(TestArray, BytewiseComparison) {
+  s21::array<uint8_t, 32> hash{};
+  s21::array<uint8_t, 32> other{};
+  EXPECT_TRUE(hash == other);
+  other[31] = 1;
+  EXPECT_TRUE(hash != other);
+  EXPECT_TRUE(hash < other);
+  hash[0] = 0x80;
+  EXPECT_TRUE(other < hash);
+  EXPECT_FALSE(hash <= other);
+
+  s21::array<int, 100> keys{};
+  s21::array<int, 100> more_keys{};
+  more_keys[70] = -1;
+  EXPECT_TRUE(more_keys < keys);
+  EXPECT_FALSE(keys < more_keys);
+  EXPECT_FALSE(keys < keys);
+  keys[99] = -5;
+  more_keys[70] = 0;
+  EXPECT_TRUE(keys < more_keys);
+
+  s21::array<double, 2> zeros = {0.0, -0.0};
+  s21::array<double, 2> signed_zeros = {-0.0, 0.0};
+  EXPECT_TRUE(zeros == signed_zeros);
+}
+
+TEST(TestArray, BytewiseFillAndSwap) {
+  s21::array<char, 100> letters;
+  letters.fill('x');
+  EXPECT_EQ(100, std::count(letters.begin(), letters.end(), 'x'));
+  s21::array<uint64_t, 20> lhs;
+  s21::array<uint64_t, 20> rhs;
+  lhs.fill(1);
+  rhs.fill(2);
+  lhs.swap(rhs);
+  EXPECT_EQ(20, std::count(lhs.begin(), lhs.end(), 2));
+  EXPECT_EQ(20, std::count(rhs.begin(), rhs.end(), 1));
+  lhs.swap(lhs);
+  EXPECT_EQ(2, lhs.back());
+}
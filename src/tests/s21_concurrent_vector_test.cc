@@ -0,0 +1,276 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../containers/s21_concurrent_vector.h"
+
+namespace {
+struct Sample {
+  int producer;
+  int sequence;
+  int check;
+};
+
+struct Counted {
+  static int alive;
+  Counted() { ++alive; }
+  Counted(const Counted &) { ++alive; }
+  Counted(Counted &&) noexcept { ++alive; }
+  ~Counted() { --alive; }
+};
+
+int Counted::alive = 0;
+
+struct ThrowingCopy {
+  ThrowingCopy() = default;
+  ThrowingCopy(const ThrowingCopy &) { throw std::runtime_error("copy"); }
+  ThrowingCopy(ThrowingCopy &&) noexcept = default;
+};
+
+template <typename T>
+struct StatefulAllocator {
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::false_type;
+
+  explicit StatefulAllocator(int id = 0) : id(id) {}
+  template <typename U>
+  StatefulAllocator(const StatefulAllocator<U> &other) : id(other.id) {}
+
+  T *allocate(size_t n) { return std::allocator<T>().allocate(n); }
+  void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  template <typename U>
+  bool operator==(const StatefulAllocator<U> &other) const {
+    return id == other.id;
+  }
+  template <typename U>
+  bool operator!=(const StatefulAllocator<U> &other) const {
+    return id != other.id;
+  }
+
+  int id;
+};
+
+// Shared by every rebound FailingAllocator
+int fail_next = 0;
+
+// Fails the next fail_next allocations with std::bad_alloc
+template <typename T>
+struct FailingAllocator {
+  using value_type = T;
+
+  FailingAllocator() = default;
+  template <typename U>
+  FailingAllocator(const FailingAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    if (fail_next > 0) {
+      --fail_next;
+      throw std::bad_alloc();
+    }
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  template <typename U>
+  bool operator==(const FailingAllocator<U> &) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const FailingAllocator<U> &) const {
+    return false;
+  }
+};
+}  // namespace
+
+TEST(TestConcurrentVector, PushBack) {
+  s21::concurrent_vector<int> vec;
+  EXPECT_TRUE(vec.empty());
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(static_cast<size_t>(i), vec.push_back(i * 2));
+  }
+  ASSERT_EQ(1000, vec.size());
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(i * 2, vec[i]);
+  EXPECT_EQ(0, vec.front());
+  EXPECT_EQ(1998, vec.at(999));
+  EXPECT_THROW(vec.at(1000), std::out_of_range);
+}
+
+TEST(TestConcurrentVector, ElementsNeverMove) {
+  s21::concurrent_vector<std::string> vec;
+  vec.emplace_back(3, 'a');
+  const std::string *first = &vec[0];
+  for (int i = 0; i < 5000; ++i) vec.push_back(std::to_string(i));
+  EXPECT_EQ(first, &vec[0]);
+  EXPECT_EQ("aaa", vec[0]);
+  EXPECT_EQ("4999", vec[5000]);
+}
+
+TEST(TestConcurrentVector, Iterators) {
+  s21::concurrent_vector<int> vec;
+  for (int i = 0; i < 100; ++i) vec.push_back(i);
+  int expected = 0;
+  for (int value : vec) EXPECT_EQ(expected++, value);
+  EXPECT_EQ(100, expected);
+  const auto &cvec = vec;
+  EXPECT_EQ(100, cvec.end() - cvec.begin());
+  EXPECT_EQ(4950, std::accumulate(cvec.begin(), cvec.end(), 0));
+  auto it = vec.end();
+  --it;
+  EXPECT_EQ(99, *it);
+  EXPECT_EQ(42, vec.begin()[42]);
+}
+
+TEST(TestConcurrentVector, ReserveAndClear) {
+  s21::concurrent_vector<int> vec;
+  vec.reserve(100);
+  size_t capacity = vec.capacity();
+  EXPECT_GE(capacity, 100);
+  for (int i = 0; i < 100; ++i) vec.push_back(i);
+  EXPECT_EQ(capacity, vec.capacity());
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(capacity, vec.capacity());
+  EXPECT_EQ(0, vec.push_back(7));
+  EXPECT_EQ(7, vec[0]);
+}
+
+TEST(TestConcurrentVector, DestroysEveryElement) {
+  {
+    s21::concurrent_vector<Counted> vec;
+    for (int i = 0; i < 100; ++i) vec.emplace_back();
+    vec.clear();
+    EXPECT_EQ(0, Counted::alive);
+    for (int i = 0; i < 50; ++i) vec.push_back(Counted());
+    EXPECT_EQ(50, Counted::alive);
+  }
+  EXPECT_EQ(0, Counted::alive);
+}
+
+TEST(TestConcurrentVector, DestroysElementsPastAMissingSegment) {
+  {
+    s21::concurrent_vector<Counted, FailingAllocator<Counted>> vec;
+    for (int i = 0; i < 8; ++i) vec.emplace_back();
+    // Every slot of the second segment is lost to a failed allocation
+    fail_next = 16;
+    for (int i = 0; i < 16; ++i) {
+      EXPECT_THROW(vec.emplace_back(), std::bad_alloc);
+    }
+    EXPECT_EQ(24, vec.emplace_back());
+    EXPECT_EQ(8, vec.size());
+    EXPECT_EQ(9, Counted::alive);
+  }
+  EXPECT_EQ(0, Counted::alive);
+}
+
+TEST(TestConcurrentVector, ThrowingCopyTakesNoSlot) {
+  s21::concurrent_vector<ThrowingCopy> vec;
+  ThrowingCopy value;
+  EXPECT_THROW(vec.push_back(value), std::runtime_error);
+  EXPECT_EQ(0, vec.push_back(ThrowingCopy()));
+  EXPECT_EQ(1, vec.size());
+}
+
+TEST(TestConcurrentVector, MoveAndSwap) {
+  s21::concurrent_vector<int> vec;
+  for (int i = 0; i < 20; ++i) vec.push_back(i);
+  s21::concurrent_vector<int> moved(std::move(vec));
+  EXPECT_EQ(20, moved.size());
+  EXPECT_TRUE(vec.empty());
+  s21::concurrent_vector<int> other;
+  other.push_back(-1);
+  other.swap(moved);
+  EXPECT_EQ(20, other.size());
+  EXPECT_EQ(19, other[19]);
+  ASSERT_EQ(1, moved.size());
+  EXPECT_EQ(-1, moved[0]);
+  vec = std::move(other);
+  EXPECT_EQ(20, vec.size());
+}
+
+TEST(TestConcurrentVector, MoveAssignKeepsUnequalAllocator) {
+  using Vector =
+      s21::concurrent_vector<std::string, StatefulAllocator<std::string>>;
+  static_assert(
+      std::is_nothrow_move_assignable_v<s21::concurrent_vector<std::string>>);
+  static_assert(!std::is_nothrow_move_assignable_v<Vector>);
+
+  Vector vec(StatefulAllocator<std::string>(1));
+  for (int i = 0; i < 20; ++i) vec.push_back(std::to_string(i));
+  Vector same(StatefulAllocator<std::string>(1));
+  const std::string *first = &vec[0];
+  same = std::move(vec);
+  EXPECT_EQ(first, &same[0]);
+
+  Vector other(StatefulAllocator<std::string>(2));
+  other.push_back("old");
+  other = std::move(same);
+  EXPECT_NE(first, &other[0]);
+  EXPECT_EQ(2, other.get_allocator().id);
+  ASSERT_EQ(20, other.size());
+  EXPECT_EQ("19", other[19]);
+  EXPECT_TRUE(same.empty());
+}
+
+TEST(TestConcurrentVector, ConcurrentProducers) {
+  constexpr int kProducers = 4;
+  constexpr int kPerProducer = 20000;
+  s21::concurrent_vector<Sample> vec;
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&vec, p] {
+      for (int i = 0; i < kPerProducer; ++i) {
+        vec.push_back(Sample{p, i, p * kPerProducer + i});
+      }
+    });
+  }
+  for (auto &producer : producers) producer.join();
+  ASSERT_EQ(static_cast<size_t>(kProducers * kPerProducer), vec.size());
+  std::vector<int> last(kProducers, -1);
+  std::vector<bool> seen(kProducers * kPerProducer, false);
+  for (const Sample &sample : vec) {
+    EXPECT_EQ(sample.producer * kPerProducer + sample.sequence, sample.check);
+    EXPECT_LT(last[sample.producer], sample.sequence);
+    last[sample.producer] = sample.sequence;
+    seen[sample.check] = true;
+  }
+  EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](bool b) { return b; }));
+}
+
+TEST(TestConcurrentVector, ReadersSeeOnlyFinishedElements) {
+  constexpr int kProducers = 3;
+  constexpr int kPerProducer = 20000;
+  s21::concurrent_vector<std::string> vec;
+  std::atomic<bool> done{false};
+  std::atomic<int> bad{0};
+  std::thread reader([&] {
+    size_t checked = 0;
+    while (!done.load() || checked < vec.size()) {
+      size_t size = vec.size();
+      for (; checked < size; ++checked) {
+        const std::string &value = vec[checked];
+        if (value.size() != 40 || value.front() != value.back()) ++bad;
+      }
+    }
+  });
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&vec, p] {
+      for (int i = 0; i < kPerProducer; ++i) vec.emplace_back(40, 'a' + p);
+    });
+  }
+  for (auto &producer : producers) producer.join();
+  done.store(true);
+  reader.join();
+  EXPECT_EQ(0, bad.load());
+  EXPECT_EQ(static_cast<size_t>(kProducers * kPerProducer), vec.size());
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../containers/s21_cow_vector.h"
+
+TEST(TestCowVector, CopyShares) {
+  s21::cow_vector<int> vec = {1, 2, 3};
+  EXPECT_EQ(1, vec.use_count());
+  s21::cow_vector<int> copy = vec;
+  EXPECT_EQ(2, vec.use_count());
+  EXPECT_EQ(vec.cbegin(), copy.cbegin());
+  EXPECT_EQ(3, copy.size());
+  EXPECT_EQ(2, copy[1]);
+}
+
+TEST(TestCowVector, FirstMutationDetaches) {
+  s21::cow_vector<int> vec = {1, 2, 3};
+  s21::cow_vector<int> copy = vec;
+  const int *shared = vec.cbegin();
+  copy.push_back(4);
+  EXPECT_EQ(1, vec.use_count());
+  EXPECT_EQ(1, copy.use_count());
+  EXPECT_EQ(shared, vec.cbegin());
+  EXPECT_EQ(3, vec.size());
+  ASSERT_EQ(4, copy.size());
+  EXPECT_EQ(4, copy.back());
+  EXPECT_GE(copy.capacity(), 4);
+}
+
+TEST(TestCowVector, MutableAccessDetaches) {
+  s21::cow_vector<std::string> vec = {"a", "b"};
+  s21::cow_vector<std::string> copy = vec;
+  copy[0] = "changed";
+  EXPECT_EQ("a", vec[0]);
+  EXPECT_EQ("changed", copy[0]);
+  s21::cow_vector<std::string> other = vec;
+  *other.begin() = "x";
+  other.at(1) = "y";
+  EXPECT_EQ("a", vec.front());
+  EXPECT_EQ("b", vec.back());
+  EXPECT_EQ("x", other.front());
+  EXPECT_EQ("y", other.back());
+  EXPECT_THROW(other.at(2), std::out_of_range);
+}
+
+TEST(TestCowVector, ConstAccessDoesNotDetach) {
+  s21::cow_vector<int> vec = {5, 6};
+  const s21::cow_vector<int> copy = vec;
+  int sum = 0;
+  for (int value : copy) sum += value;
+  EXPECT_EQ(11, sum);
+  EXPECT_EQ(6, copy.at(1));
+  EXPECT_EQ(2, vec.use_count());
+}
+
+TEST(TestCowVector, UniqueOwnerWritesInPlace) {
+  s21::cow_vector<int> vec;
+  vec.reserve(10);
+  const int *storage = vec.cbegin();
+  for (int i = 0; i < 10; ++i) vec.push_back(i);
+  EXPECT_EQ(storage, vec.cbegin());
+  vec[3] = 42;
+  EXPECT_EQ(storage, vec.cbegin());
+}
+
+TEST(TestCowVector, InsertAndEraseOnSharedCopy) {
+  s21::cow_vector<int> vec = {1, 2, 3, 4, 5};
+  s21::cow_vector<int> copy = vec;
+  auto it = copy.insert(copy.cbegin() + 2, 10);
+  EXPECT_EQ(10, *it);
+  s21::cow_vector<int> other = vec;
+  it = other.erase(other.cbegin() + 1, other.cbegin() + 3);
+  EXPECT_EQ(4, *it);
+  ASSERT_EQ(3, other.size());
+  EXPECT_EQ(1, other[0]);
+  EXPECT_EQ(5, other[2]);
+  ASSERT_EQ(6, copy.size());
+  EXPECT_EQ(3, copy[3]);
+  EXPECT_EQ(5, vec.size());
+}
+
+TEST(TestCowVector, ArgumentFromSharedBuffer) {
+  s21::cow_vector<std::string> vec = {std::string(100, 'x')};
+  {
+    s21::cow_vector<std::string> copy = vec;
+    const std::string &first = std::as_const(vec)[0];
+    vec.push_back(first);
+    EXPECT_EQ(1, copy.size());
+  }
+  ASSERT_EQ(2, vec.size());
+  EXPECT_EQ(vec[0], vec[1]);
+}
+
+TEST(TestCowVector, ClearDropsSharedBuffer) {
+  s21::cow_vector<int> vec = {1, 2, 3};
+  s21::cow_vector<int> copy = vec;
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(0, copy.use_count());
+  EXPECT_EQ(3, vec.size());
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(1, vec.use_count());
+}
+
+TEST(TestCowVector, FromVectorAndResize) {
+  s21::vector<int> items = {1, 2, 3};
+  s21::cow_vector<int> vec(std::move(items));
+  s21::cow_vector<int> copy = vec;
+  copy.resize(5, 7);
+  EXPECT_EQ(3, vec.size());
+  ASSERT_EQ(5, copy.size());
+  EXPECT_EQ(7, copy[4]);
+  copy.pop_back();
+  copy.shrink_to_fit();
+  EXPECT_EQ(4, copy.size());
+  s21::cow_vector<int> sized(4);
+  EXPECT_EQ(0, sized[3]);
+}
+
+TEST(TestCowVector, MoveAndSwap) {
+  s21::cow_vector<int> vec = {1, 2};
+  s21::cow_vector<int> moved(std::move(vec));
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(1, moved.use_count());
+  s21::cow_vector<int> other = {9};
+  other.swap(moved);
+  EXPECT_EQ(2, other.size());
+  EXPECT_EQ(9, moved[0]);
+  vec = std::move(other);
+  EXPECT_EQ(2, vec.size());
+}
+
+TEST(TestCowVector, SnapshotsAcrossThreads) {
+  s21::cow_vector<int> config;
+  for (int i = 0; i < 1000; ++i) config.push_back(i);
+  std::vector<std::thread> workers;
+  std::vector<long> sums(4, 0);
+  for (int w = 0; w < 4; ++w) {
+    s21::cow_vector<int> snapshot = config;
+    workers.emplace_back([snapshot, &sums, w]() mutable {
+      for (int round = 0; round < 100; ++round) {
+        for (int value : std::as_const(snapshot)) sums[w] += value;
+      }
+      snapshot.push_back(-1);
+    });
+  }
+  for (int i = 0; i < 1000; ++i) config[i] = 0;
+  for (auto &worker : workers) worker.join();
+  for (long sum : sums) EXPECT_EQ(100L * 999 * 1000 / 2, sum);
+  EXPECT_EQ(1, config.use_count());
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../containers/s21_mdarray.h"
+
+TEST(TestMdarray, Extents) {
+  using shape = s21::extents<3, s21::dynamic_extent, 4>;
+  EXPECT_EQ(3, shape::rank());
+  EXPECT_EQ(1, shape::rank_dynamic());
+  EXPECT_EQ(s21::dynamic_extent, shape::static_extent(1));
+  constexpr shape sizes(5);
+  static_assert(sizes.extent(1) == 5);
+  static_assert(sizes.size() == 60);
+  EXPECT_EQ(4, sizes.extent(2));
+  static_assert(sizeof(s21::extents<2, s21::dynamic_extent>) == sizeof(size_t));
+}
+
+TEST(TestMdarray, StaticExtentsUseArray) {
+  s21::mdarray<int, 2, 3> matrix;
+  EXPECT_EQ(sizeof(int) * 6, sizeof(matrix));
+  EXPECT_EQ(6, matrix.size());
+  for (size_t i = 0; i < 2; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      EXPECT_EQ(0, matrix(i, j));
+      matrix(i, j) = static_cast<int>(i * 3 + j);
+    }
+  }
+  for (int k = 0; k < 6; ++k) EXPECT_EQ(k, matrix.data()[k]);
+}
+
+TEST(TestMdarray, DynamicExtentsUseVector) {
+  s21::mdarray<double, s21::dynamic_extent, s21::dynamic_extent> matrix(3, 5);
+  EXPECT_EQ(2, matrix.rank());
+  EXPECT_EQ(3, matrix.extent(0));
+  EXPECT_EQ(5, matrix.extent(1));
+  matrix(2, 4) = 1.5;
+  EXPECT_EQ(1.5, matrix.data()[14]);
+  EXPECT_EQ(1.5, matrix.at(2, 4));
+  EXPECT_THROW(matrix.at(3, 0), std::out_of_range);
+  EXPECT_THROW(matrix.at(0, 5), std::out_of_range);
+  s21::mdarray<double, s21::dynamic_extent, s21::dynamic_extent> empty;
+  EXPECT_TRUE(empty.empty());
+}
+
+TEST(TestMdarray, ColumnMajorLayout) {
+  s21::basic_mdarray<int, s21::extents<2, 3>, s21::layout_left> matrix;
+  for (size_t i = 0; i < 2; ++i) {
+    for (size_t j = 0; j < 3; ++j) matrix(i, j) = static_cast<int>(i * 3 + j);
+  }
+  int expected[] = {0, 3, 1, 4, 2, 5};
+  for (int k = 0; k < 6; ++k) EXPECT_EQ(expected[k], matrix.data()[k]);
+  auto view = matrix.view();
+  EXPECT_EQ(1, view.stride(0));
+  EXPECT_EQ(2, view.stride(1));
+  EXPECT_EQ(5, view(1, 2));
+}
+
+TEST(TestMdarray, TiledLayout) {
+  s21::basic_mdarray<int, s21::extents<s21::dynamic_extent, 5>,
+                     s21::layout_tiled<2, 4>>
+      matrix(3);
+  EXPECT_EQ(15, matrix.size());
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 5; ++j) matrix(i, j) = static_cast<int>(i * 5 + j);
+  }
+  // The first tile holds rows 0-1 and columns 0-3 back to back
+  int first_tile[] = {0, 1, 2, 3, 5, 6, 7, 8};
+  for (int k = 0; k < 8; ++k) EXPECT_EQ(first_tile[k], matrix.data()[k]);
+  EXPECT_EQ(4, matrix.data()[8]);
+  auto edge = matrix.tile(1, 1);
+  EXPECT_EQ(1, edge.extent(0));
+  EXPECT_EQ(1, edge.extent(1));
+  EXPECT_EQ(14, edge(0, 0));
+  edge(0, 0) = -1;
+  EXPECT_EQ(-1, matrix(2, 4));
+  const auto &constant = matrix;
+  EXPECT_EQ(10, constant.tile(1, 0)(0, 0));
+}
+
+TEST(TestMdarray, StaticTiledPadsBuffer) {
+  s21::basic_mdarray<char, s21::extents<3, 3>, s21::layout_tiled<2>> matrix;
+  EXPECT_EQ(16, sizeof(matrix));
+  matrix.fill('x');
+  EXPECT_EQ('x', matrix(2, 2));
+}
+
+TEST(TestMdarray, StridedSubviews) {
+  s21::mdarray<int, 4, 6> matrix;
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 6; ++j) matrix(i, j) = static_cast<int>(i * 10 + j);
+  }
+  auto block = matrix.view().slice(0, 1, 2).slice(1, 2, 3);
+  EXPECT_EQ(6, block.size());
+  EXPECT_EQ(12, block(0, 0));
+  EXPECT_EQ(24, block(1, 2));
+  auto even_columns = matrix.view().slice(1, 0, 3, 2);
+  EXPECT_EQ(2, even_columns.stride(1));
+  EXPECT_EQ(34, even_columns(3, 2));
+  auto row = matrix.view()[2];
+  EXPECT_EQ(1, row.rank());
+  EXPECT_EQ(25, row(5));
+  row(5) = 0;
+  EXPECT_EQ(0, matrix(2, 5));
+  s21::strided_view<const int, 2> readonly = matrix.view();
+  EXPECT_EQ(33, readonly.transposed()(3, 3));
+  EXPECT_EQ(31, readonly.transposed()(1, 3));
+}
+
+TEST(TestMdarray, ThreeDimensions) {
+  s21::mdarray<int, 2, s21::dynamic_extent, 3> cube(4);
+  EXPECT_EQ(24, cube.size());
+  cube(1, 3, 2) = 7;
+  EXPECT_EQ(7, cube.data()[23]);
+  auto plane = cube.view()[1];
+  EXPECT_EQ(7, plane(3, 2));
+  s21::basic_mdarray<int, s21::extents<2, 4, 3>, s21::layout_left> other;
+  s21::copy(cube.view(), other.view());
+  EXPECT_EQ(7, other(1, 3, 2));
+  EXPECT_EQ(7, other.data()[23]);
+}
+
+TEST(TestMdarray, BlockedTranspose) {
+  const size_t rows = 70, cols = 45;
+  s21::mdarray<int, s21::dynamic_extent, s21::dynamic_extent> src(rows, cols);
+  for (size_t i = 0; i < rows; ++i) {
+    for (size_t j = 0; j < cols; ++j) {
+      src(i, j) = static_cast<int>(i * cols + j);
+    }
+  }
+  s21::mdarray<long, s21::dynamic_extent, s21::dynamic_extent> dst(cols, rows);
+  s21::transpose(std::as_const(src).view(), dst.view());
+  for (size_t i = 0; i < rows; ++i) {
+    for (size_t j = 0; j < cols; ++j) ASSERT_EQ(src(i, j), dst(j, i));
+  }
+  EXPECT_THROW(s21::transpose(src.view(), src.view()), std::invalid_argument);
+}
+
+TEST(TestMdarray, CopyToTiles) {
+  const size_t n = 33;
+  s21::mdarray<double, s21::dynamic_extent, s21::dynamic_extent> src(n, n);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) src(i, j) = static_cast<double>(i - j);
+  }
+  using tiled = s21::layout_tiled<8>;
+  s21::basic_mdarray<double, s21::extents<s21::dynamic_extent, 33>, tiled>
+      dst(n);
+  for (size_t ti = 0; ti * 8 < n; ++ti) {
+    for (size_t tj = 0; tj * 8 < n; ++tj) {
+      auto tile = dst.tile(ti, tj);
+      s21::copy(src.view()
+                    .slice(0, ti * 8, tile.extent(0))
+                    .slice(1, tj * 8, tile.extent(1)),
+                tile);
+    }
+  }
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) ASSERT_EQ(src(i, j), dst(i, j));
+  }
+}
+
+TEST(TestMdarray, CopyAndSwap) {
+  s21::mdarray<std::string, s21::dynamic_extent, 2> names(2);
+  names(1, 1) = "last";
+  auto copy = names;
+  copy(0, 0) = "first";
+  EXPECT_EQ("", names(0, 0));
+  EXPECT_EQ("last", copy(1, 1));
+  s21::mdarray<std::string, s21::dynamic_extent, 2> other(1);
+  other.swap(copy);
+  EXPECT_EQ(1, copy.extent(0));
+  EXPECT_EQ(2, other.extent(0));
+  EXPECT_EQ("first", other(0, 0));
+  static_assert(
+      std::is_same_v<decltype(std::as_const(names).view()),
+                     s21::strided_view<const std::string, 2>>);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+#include "../containers/s21_mmap_vector.h"
+
+namespace {
+struct Record {
+  uint64_t id;
+  double value;
+};
+
+// A fresh file per test, removed again when the test ends
+class TempFile {
+ public:
+  explicit TempFile(const std::string &name)
+      : path_(testing::TempDir() + "s21_mmap_vector_" + name) {
+    std::remove(path_.c_str());
+  }
+  ~TempFile() { std::remove(path_.c_str()); }
+  const std::string &path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+}  // namespace
+
+TEST(TestMmapVector, CreatesEmpty) {
+  TempFile file("creates_empty");
+  s21::mmap_vector<int> vec(file.path());
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(0, vec.size());
+  EXPECT_EQ(file.path(), vec.path());
+}
+
+TEST(TestMmapVector, ReopenKeepsElements) {
+  TempFile file("reopen");
+  {
+    s21::mmap_vector<Record> vec(file.path());
+    for (uint64_t i = 0; i < 100000; ++i) {
+      vec.push_back({i, i * 0.5});
+    }
+    vec.sync();
+  }
+  s21::mmap_vector<Record> vec(file.path());
+  ASSERT_EQ(100000, vec.size());
+  EXPECT_GE(vec.capacity(), vec.size());
+  EXPECT_EQ(77777, vec[77777].id);
+  EXPECT_DOUBLE_EQ(49999.5, vec.back().value);
+
+  vec.push_back({1, 1});
+  EXPECT_EQ(100001, vec.size());
+}
+
+TEST(TestMmapVector, SharedBetweenMappings) {
+  TempFile file("shared");
+  s21::mmap_vector<int> writer(file.path());
+  writer.resize(10, 3);
+  s21::mmap_vector<int> reader(file.path());
+  ASSERT_EQ(10, reader.size());
+  writer[4] = 42;
+  EXPECT_EQ(42, reader[4]);
+}
+
+TEST(TestMmapVector, InsertAndErase) {
+  TempFile file("insert_erase");
+  s21::mmap_vector<int> vec(file.path());
+  vec.insert_many_back(1, 2, 4);
+  vec.insert(vec.cbegin() + 2, 3);
+  vec.insert_many(vec.cbegin(), -1, 0);
+  EXPECT_EQ(vec.begin() + 1, vec.insert_many(vec.cbegin() + 1));
+  vec.insert_many_back();
+  ASSERT_EQ(6, vec.size());
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(i - 1, vec[i]);
+  }
+
+  auto pos = vec.erase(vec.cbegin(), vec.cbegin() + 2);
+  EXPECT_EQ(1, *pos);
+  vec.erase(vec.cend() - 1);
+  vec.pop_back();
+  EXPECT_EQ(2, vec.size());
+  EXPECT_EQ(2, vec.back());
+  EXPECT_THROW(vec.at(2), std::out_of_range);
+}
+
+TEST(TestMmapVector, InsertOwnElement) {
+  TempFile file("insert_own");
+  s21::mmap_vector<int> vec(file.path());
+  vec.push_back(7);
+  vec.shrink_to_fit();
+  ASSERT_EQ(1, vec.capacity());
+  vec.insert(vec.cbegin(), vec[0]);
+  vec.push_back(vec[0]);
+  vec.append(vec.data(), vec.size());
+  EXPECT_EQ(6, vec.size());
+  for (int value : vec) {
+    EXPECT_EQ(7, value);
+  }
+}
+
+TEST(TestMmapVector, ShrinkToFitTruncates) {
+  TempFile file("shrink");
+  s21::mmap_vector<int> vec(file.path());
+  vec.reserve(10000);
+  EXPECT_EQ(10000, vec.capacity());
+  vec.resize(5);
+  vec.shrink_to_fit();
+  EXPECT_EQ(5, vec.capacity());
+  EXPECT_EQ(0, vec[4]);
+}
+
+TEST(TestMmapVector, RejectsOtherFiles) {
+  TempFile file("rejects");
+  {
+    s21::mmap_vector<int32_t> vec(file.path());
+    vec.push_back(1);
+  }
+  EXPECT_THROW(s21::mmap_vector<int64_t> vec(file.path()),
+               std::invalid_argument);
+
+  TempFile text("text");
+  std::FILE *stream = std::fopen(text.path().c_str(), "w");
+  std::fputs("definitely not a vector, just some text in a file\n", stream);
+  std::fputs("long enough to cover the whole header of the format\n", stream);
+  std::fclose(stream);
+  EXPECT_THROW(s21::mmap_vector<int> vec(text.path()), std::invalid_argument);
+}
+
+TEST(TestMmapVector, MoveAndSwap) {
+  TempFile first("move_first");
+  TempFile second("move_second");
+  s21::mmap_vector<int> a(first.path());
+  s21::mmap_vector<int> b(second.path());
+  a.push_back(1);
+  b.insert_many_back(2, 3);
+
+  a.swap(b);
+  EXPECT_EQ(2, a.size());
+  EXPECT_EQ(second.path(), a.path());
+
+  s21::mmap_vector<int> c(std::move(a));
+  EXPECT_EQ(3, c.back());
+  b = std::move(c);
+  EXPECT_EQ(2, b.size());
+}
@@ -0,0 +1,284 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../containers/s21_segmented_vector.h"
+
+TEST(TestSegmentedVector, BasicConstructor) {
+  s21::segmented_vector<int> vec;
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(0, vec.size());
+  EXPECT_EQ(0, vec.capacity());
+  EXPECT_EQ(vec.begin(), vec.end());
+}
+
+TEST(TestSegmentedVector, SizeConstructor) {
+  s21::segmented_vector<double> vec(20);
+  EXPECT_EQ(20, vec.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_DOUBLE_EQ(0, vec[i]);
+  }
+}
+
+TEST(TestSegmentedVector, InitializerListConstructor) {
+  s21::segmented_vector<char> vec({'a', 'b', 'c'});
+  EXPECT_EQ(3, vec.size());
+  EXPECT_EQ('a', vec.front());
+  EXPECT_EQ('b', vec[1]);
+  EXPECT_EQ('c', vec.back());
+}
+
+TEST(TestSegmentedVector, AddressesStayStable) {
+  s21::segmented_vector<int> vec;
+  std::vector<int*> addresses;
+  for (int i = 0; i < 10000; ++i) {
+    addresses.push_back(&vec.emplace_back(i));
+  }
+  for (int i = 0; i < 10000; ++i) {
+    EXPECT_EQ(addresses[i], &vec[i]);
+    EXPECT_EQ(i, *addresses[i]);
+  }
+}
+
+TEST(TestSegmentedVector, CapacityGrowsBySegments) {
+  s21::segmented_vector<int> vec;
+  vec.push_back(1);
+  EXPECT_EQ(8, vec.capacity());
+  vec.reserve(9);
+  EXPECT_EQ(24, vec.capacity());
+  vec.reserve(100);
+  EXPECT_EQ(120, vec.capacity());
+  vec.shrink_to_fit();
+  EXPECT_EQ(8, vec.capacity());
+  vec.clear();
+  vec.shrink_to_fit();
+  EXPECT_EQ(0, vec.capacity());
+}
+
+TEST(TestSegmentedVector, At) {
+  s21::segmented_vector<int> vec = {1, 2, 3};
+  EXPECT_EQ(3, vec.at(2));
+  EXPECT_THROW(vec.at(3), std::out_of_range);
+}
+
+TEST(TestSegmentedVector, IteratorsCrossSegments) {
+  s21::segmented_vector<int> vec;
+  for (int i = 0; i < 1000; ++i) {
+    vec.push_back(i);
+  }
+  int expected = 0;
+  for (int value : vec) {
+    EXPECT_EQ(expected++, value);
+  }
+  EXPECT_EQ(1000, expected);
+
+  auto it = vec.end();
+  for (int i = 999; i >= 0; --i) {
+    EXPECT_EQ(i, *--it);
+  }
+  EXPECT_EQ(vec.begin(), it);
+
+  EXPECT_EQ(1000, vec.end() - vec.begin());
+  EXPECT_EQ(500, *(vec.begin() + 500));
+  EXPECT_EQ(77, vec.cbegin()[77]);
+  EXPECT_EQ(499500, std::accumulate(vec.cbegin(), vec.cend(), 0));
+}
+
+TEST(TestSegmentedVector, EndAtFullCapacity) {
+  s21::segmented_vector<int> vec;
+  for (int i = 0; i < 24; ++i) {
+    vec.push_back(i);
+  }
+  ASSERT_EQ(vec.size(), vec.capacity());
+  auto it = vec.end();
+  EXPECT_EQ(23, *--it);
+  EXPECT_EQ(24, std::distance(vec.begin(), vec.end()));
+}
+
+TEST(TestSegmentedVector, Sort) {
+  s21::segmented_vector<int> vec;
+  for (int i = 0; i < 300; ++i) {
+    vec.push_back((i * 37) % 300);
+  }
+  std::sort(vec.begin(), vec.end());
+  for (int i = 0; i < 300; ++i) {
+    EXPECT_EQ(i, vec[i]);
+  }
+}
+
+TEST(TestSegmentedVector, InsertAndErase) {
+  s21::segmented_vector<std::string> vec = {"a", "b", "d"};
+  auto it = vec.insert(vec.cbegin() + 2, "c");
+  EXPECT_EQ("c", *it);
+  it = vec.insert_many(vec.cbegin(), "x", "y");
+  EXPECT_EQ("x", *it);
+  EXPECT_EQ(6, vec.size());
+  EXPECT_EQ("y", vec[1]);
+  EXPECT_EQ("a", vec[2]);
+
+  it = vec.erase(vec.cbegin(), vec.cbegin() + 2);
+  EXPECT_EQ("a", *it);
+  it = vec.erase(vec.cbegin() + 1);
+  EXPECT_EQ("c", *it);
+  EXPECT_EQ(3, vec.size());
+  EXPECT_EQ("d", vec.back());
+}
+
+TEST(TestSegmentedVector, Resize) {
+  s21::segmented_vector<int> vec = {1, 2};
+  vec.resize(30, 7);
+  EXPECT_EQ(30, vec.size());
+  EXPECT_EQ(7, vec[29]);
+  vec.resize(1);
+  EXPECT_EQ(1, vec.size());
+  EXPECT_EQ(1, vec.back());
+  vec.resize(3);
+  EXPECT_EQ(0, vec[2]);
+}
+
+TEST(TestSegmentedVector, CopyAndMove) {
+  s21::segmented_vector<std::string> vec;
+  for (int i = 0; i < 50; ++i) {
+    vec.push_back(std::to_string(i));
+  }
+  s21::segmented_vector<std::string> copy(vec);
+  EXPECT_EQ(50, copy.size());
+  EXPECT_EQ("49", copy[49]);
+
+  std::string *first = &vec[0];
+  s21::segmented_vector<std::string> moved(std::move(vec));
+  EXPECT_EQ(first, &moved[0]);
+  EXPECT_TRUE(vec.empty());
+
+  vec = moved;
+  EXPECT_EQ("17", vec[17]);
+  copy = std::move(moved);
+  EXPECT_EQ(first, &copy[0]);
+}
+
+TEST(TestSegmentedVector, Swap) {
+  s21::segmented_vector<int> a = {1, 2, 3};
+  s21::segmented_vector<int> b = {4};
+  int *first = &a[0];
+  a.swap(b);
+  EXPECT_EQ(1, a.size());
+  EXPECT_EQ(3, b.size());
+  EXPECT_EQ(first, &b[0]);
+}
+
+TEST(TestSegmentedVector, IteratorsFollowElements) {
+  s21::segmented_vector<int> a;
+  for (int i = 0; i < 40; ++i) a.push_back(i);
+  s21::segmented_vector<int> b = {-1};
+  auto it = a.begin() + 20;
+  a.swap(b);
+  EXPECT_EQ(20, *it);
+  EXPECT_EQ(39, *(it + 19));
+  EXPECT_EQ(b.end(), it + 20);
+
+  s21::segmented_vector<int> moved(std::move(b));
+  EXPECT_EQ(21, *++it);
+  EXPECT_EQ(moved.end(), it + 19);
+  s21::segmented_vector<int> assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(22, *++it);
+  EXPECT_EQ(assigned.begin() + 22, it);
+}
+
+namespace {
+template <typename T>
+struct StatefulAllocator {
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::false_type;
+
+  explicit StatefulAllocator(int id = 0) : id(id) {}
+  template <typename U>
+  StatefulAllocator(const StatefulAllocator<U> &other) : id(other.id) {}
+
+  T *allocate(size_t n) { return std::allocator<T>().allocate(n); }
+  void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  bool operator==(const StatefulAllocator &other) const {
+    return id == other.id;
+  }
+  bool operator!=(const StatefulAllocator &other) const {
+    return id != other.id;
+  }
+
+  int id;
+};
+}  // namespace
+
+TEST(TestSegmentedVector, MoveAssignWithUnequalAllocators) {
+  using Vector =
+      s21::segmented_vector<std::string, StatefulAllocator<std::string>>;
+  static_assert(
+      std::is_nothrow_move_assignable_v<s21::segmented_vector<std::string>>);
+  static_assert(!std::is_nothrow_move_assignable_v<Vector>);
+
+  Vector vec({"a", "b"}, StatefulAllocator<std::string>(1));
+  Vector same({"c"}, StatefulAllocator<std::string>(1));
+  Vector other({"d"}, StatefulAllocator<std::string>(2));
+  std::string *first = &vec[0];
+  same = std::move(vec);
+  EXPECT_EQ(first, &same[0]);
+
+  other = std::move(same);
+  EXPECT_NE(first, &other[0]);
+  EXPECT_EQ(2, other.get_allocator().id);
+  ASSERT_EQ(2, other.size());
+  EXPECT_EQ("b", other[1]);
+  EXPECT_TRUE(same.empty());
+}
+
+namespace {
+template <typename T>
+struct CopiedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+
+  explicit CopiedAllocator(int id = 0) : id(id) {}
+  template <typename U>
+  CopiedAllocator(const CopiedAllocator<U> &other) : id(other.id) {}
+
+  T *allocate(size_t n) {
+    ++live[id];
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) {
+    --live[id];
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  bool operator==(const CopiedAllocator &other) const {
+    return id == other.id;
+  }
+  bool operator!=(const CopiedAllocator &other) const {
+    return id != other.id;
+  }
+
+  static inline int live[3] = {};
+  int id;
+};
+}  // namespace
+
+TEST(TestSegmentedVector, CopyAssignPropagatesAllocator) {
+  using Vector = s21::segmented_vector<int, CopiedAllocator<int>>;
+  {
+    Vector vec({1, 2, 3}, CopiedAllocator<int>(1));
+    Vector other({4}, CopiedAllocator<int>(2));
+    vec = other;
+    EXPECT_EQ(2, vec.get_allocator().id);
+    ASSERT_EQ(1, vec.size());
+    EXPECT_EQ(4, vec[0]);
+    EXPECT_EQ(0, CopiedAllocator<int>::live[1]);
+  }
+  EXPECT_EQ(0, CopiedAllocator<int>::live[1]);
+  EXPECT_EQ(0, CopiedAllocator<int>::live[2]);
+}
@@ -0,0 +1,232 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "../containers/s21_serialize.h"
+
+namespace {
+// Serializes value and reads it back into result
+template <typename T>
+void RoundTrip(const T &value, T &result) {
+  std::stringstream stream;
+  s21::serialize(stream, value);
+  s21::deserialize(stream, result);
+}
+}  // namespace
+
+TEST(TestSerialize, VectorOfIntegers) {
+  s21::vector<int> vec;
+  for (int i = 0; i < 10000; ++i) vec.push_back(i * 7 - 300);
+  s21::vector<int> result = {1, 2, 3};
+  RoundTrip(vec, result);
+  ASSERT_EQ(vec.size(), result.size());
+  for (size_t i = 0; i < vec.size(); ++i) EXPECT_EQ(vec[i], result[i]);
+}
+
+TEST(TestSerialize, VectorIsOneHeaderAndOneBlock) {
+  s21::vector<uint32_t> vec = {1, 2, 3, 4};
+  std::stringstream stream;
+  s21::serialize(stream, vec);
+  EXPECT_EQ(24 + 4 * sizeof(uint32_t), stream.str().size());
+}
+
+TEST(TestSerialize, VectorOfStrings) {
+  s21::vector<std::string> vec = {"", "a", std::string(1000, 'x'), "tail"};
+  s21::vector<std::string> result;
+  RoundTrip(vec, result);
+  ASSERT_EQ(vec.size(), result.size());
+  for (size_t i = 0; i < vec.size(); ++i) EXPECT_EQ(vec[i], result[i]);
+}
+
+TEST(TestSerialize, NestedVectors) {
+  s21::vector<s21::vector<double>> vec(3);
+  vec[0].push_back(1.5);
+  vec[2].push_back(-2.5);
+  vec[2].push_back(4.0);
+  s21::vector<s21::vector<double>> result;
+  RoundTrip(vec, result);
+  ASSERT_EQ(3, result.size());
+  EXPECT_TRUE(result[1].empty());
+  ASSERT_EQ(2, result[2].size());
+  EXPECT_EQ(-2.5, result[2][0]);
+  EXPECT_EQ(4.0, result[2][1]);
+}
+
+TEST(TestSerialize, PackedBoolVector) {
+  s21::vector<bool> vec;
+  for (int i = 0; i < 1000; ++i) vec.push_back(i % 3 == 0 || i % 7 == 0);
+  s21::vector<bool> result = {true, true};
+  std::stringstream stream;
+  s21::serialize(stream, vec);
+  EXPECT_EQ(24 + 16 * sizeof(uint64_t), stream.str().size());
+  s21::deserialize(stream, result);
+  ASSERT_EQ(vec.size(), result.size());
+  EXPECT_TRUE(vec == result);
+  EXPECT_EQ(vec.count(), result.count());
+
+  s21::vector<bool> empty;
+  RoundTrip(empty, result);
+  EXPECT_TRUE(result.empty());
+}
+
+TEST(TestSerialize, Array) {
+  s21::array<int, 4> arr = {4, 3, 2, 1};
+  s21::array<int, 4> result;
+  RoundTrip(arr, result);
+  for (size_t i = 0; i < 4; ++i) EXPECT_EQ(arr[i], result[i]);
+}
+
+TEST(TestSerialize, ArraySizeMismatch) {
+  s21::array<int, 4> arr = {4, 3, 2, 1};
+  s21::array<int, 5> result;
+  std::stringstream stream;
+  s21::serialize(stream, arr);
+  EXPECT_THROW(s21::deserialize(stream, result), std::invalid_argument);
+}
+
+TEST(TestSerialize, List) {
+  s21::list<int> lst;
+  for (int i = 0; i < 5000; ++i) lst.push_back(i % 97);
+  s21::list<int> result = {9, 9};
+  RoundTrip(lst, result);
+  ASSERT_EQ(lst.size(), result.size());
+  auto expected = lst.begin();
+  for (auto it = result.begin(); it != result.end(); ++it, ++expected) {
+    EXPECT_EQ(*expected, *it);
+  }
+}
+
+TEST(TestSerialize, Map) {
+  s21::map<int, std::string> m;
+  for (int i = 0; i < 1000; ++i) m.insert(i * 3, std::to_string(i));
+  s21::map<int, std::string> result = {{-1, "old"}};
+  RoundTrip(m, result);
+  ASSERT_EQ(m.size(), result.size());
+  EXPECT_FALSE(result.contains(-1));
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(std::to_string(i), result.at(i * 3));
+  result.insert(1, "one");
+  result.erase(result.find(0));
+  EXPECT_EQ("one", result.at(1));
+  EXPECT_EQ(1000, result.size());
+}
+
+TEST(TestSerialize, RebuiltTreeAcceptsChanges) {
+  for (int size = 0; size < 70; ++size) {
+    s21::map<int, int> m;
+    for (int i = 0; i < size; ++i) m.insert(i * 2, i);
+    s21::map<int, int> result;
+    RoundTrip(m, result);
+    for (int i = 0; i < size; ++i) result.insert(i * 2 + 1, i);
+    while (!result.empty()) result.erase(result.begin());
+    EXPECT_EQ(0, result.size());
+  }
+}
+
+TEST(TestSerialize, Set) {
+  s21::set<int> s = {5, 1, 9, 3, 7};
+  s21::set<int> result = {100};
+  RoundTrip(s, result);
+  ASSERT_EQ(5, result.size());
+  EXPECT_FALSE(result.contains(100));
+  int expected = 1;
+  for (auto it = result.begin(); it != result.end(); ++it, expected += 2) {
+    EXPECT_EQ(expected, *it);
+  }
+  EXPECT_TRUE(result.insert(4).second);
+  EXPECT_FALSE(result.insert(5).second);
+  EXPECT_EQ(6, result.size());
+}
+
+TEST(TestSerialize, Multiset) {
+  s21::multiset<int> ms = {3, 1, 3, 2, 3};
+  s21::multiset<int> result;
+  RoundTrip(ms, result);
+  ASSERT_EQ(5, result.size());
+  EXPECT_EQ(3, result.count(3));
+  EXPECT_EQ(1, result.count(1));
+  result.insert(3);
+  EXPECT_EQ(4, result.count(3));
+}
+
+TEST(TestSerialize, RejectsOtherContainer) {
+  s21::vector<int> vec = {1, 2, 3};
+  s21::list<int> result;
+  std::stringstream stream;
+  s21::serialize(stream, vec);
+  EXPECT_THROW(s21::deserialize(stream, result), std::invalid_argument);
+}
+
+TEST(TestSerialize, RejectsOtherElementSize) {
+  s21::vector<int> vec = {1, 2, 3};
+  s21::vector<int64_t> result;
+  std::stringstream stream;
+  s21::serialize(stream, vec);
+  EXPECT_THROW(s21::deserialize(stream, result), std::invalid_argument);
+}
+
+TEST(TestSerialize, RejectsOtherVersion) {
+  s21::vector<int> vec = {1, 2, 3};
+  std::stringstream stream;
+  s21::serialize(stream, vec);
+  std::string bytes = stream.str();
+  bytes[4] = 2;
+  std::stringstream changed(bytes);
+  s21::vector<int> result;
+  EXPECT_THROW(s21::deserialize(changed, result), std::invalid_argument);
+}
+
+TEST(TestSerialize, RejectsTruncatedStream) {
+  s21::vector<int> vec = {1, 2, 3};
+  std::stringstream stream;
+  s21::serialize(stream, vec);
+  std::string bytes = stream.str();
+  std::stringstream truncated(bytes.substr(0, bytes.size() - 1));
+  s21::vector<int> result;
+  EXPECT_THROW(s21::deserialize(truncated, result), std::ios_base::failure);
+}
+
+TEST(TestSerialize, RejectsHugeCountInShortStream) {
+  std::stringstream stream;
+  s21::serialize(stream, s21::vector<int>{1, 2, 3});
+  std::string bytes = stream.str();
+  const uint64_t huge = uint64_t(1) << 40;
+  std::memcpy(&bytes[16], &huge, sizeof(huge));
+  std::stringstream ints(bytes);
+  s21::vector<int> result;
+  EXPECT_THROW(s21::deserialize(ints, result), std::ios_base::failure);
+
+  stream.str("");
+  s21::serialize(stream, s21::vector<bool>{true, false});
+  bytes = stream.str();
+  std::memcpy(&bytes[16], &huge, sizeof(huge));
+  std::stringstream bits(bytes);
+  s21::vector<bool> flags;
+  EXPECT_THROW(s21::deserialize(bits, flags), std::ios_base::failure);
+}
+
+TEST(TestSerialize, LongBoolVectorSpansChunks) {
+  s21::vector<bool> vec;
+  for (int i = 0; i < 100003; ++i) vec.push_back(i % 5 == 0);
+  s21::vector<bool> result;
+  RoundTrip(vec, result);
+  EXPECT_TRUE(vec == result);
+  EXPECT_EQ(vec.count(), result.count());
+}
+
+TEST(TestSerialize, RejectsUnsortedTree) {
+  s21::vector<int> keys = {1, 3, 2};
+  std::stringstream stream;
+  s21::serialize(stream, keys);
+  std::string bytes = stream.str();
+  bytes[6] = 4;  // relabel the vector as a set
+  std::stringstream changed(bytes);
+  s21::set<int> result;
+  EXPECT_THROW(s21::deserialize(changed, result), std::invalid_argument);
+  EXPECT_TRUE(result.empty());
+  EXPECT_TRUE(result.insert(1).second);
+}
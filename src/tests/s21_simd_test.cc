@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+
+#include "../containers/s21_array.h"
+#include "../containers/s21_simd.h"
+#include "../containers/s21_vector.h"
+
+namespace {
+template <typename T>
+s21::vector<T> RandomVector(size_t size, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+  s21::vector<T> vec;
+  for (size_t i = 0; i < size; ++i) {
+    vec.push_back(static_cast<T>(dist(gen)));
+  }
+  return vec;
+}
+
+// Every size up to a few registers, so each kernel runs its scalar tail
+template <typename T>
+void CheckAgainstStd() {
+  for (size_t size = 0; size < 70; ++size) {
+    s21::vector<T> vec = RandomVector<T>(size, static_cast<unsigned>(size));
+    const T *first = vec.data();
+    const T *last = vec.data() + vec.size();
+    for (T value : {T(0), T(5), T(-1000), T(1000), T(7)}) {
+      EXPECT_EQ(std::find(first, last, value),
+                s21::simd::find(first, last, value));
+      EXPECT_EQ(static_cast<size_t>(std::count(first, last, value)),
+                s21::simd::count(first, last, value));
+      EXPECT_EQ(std::find(first, last, value) != last,
+                s21::simd::contains(first, last, value));
+    }
+    EXPECT_EQ(std::min_element(first, last),
+              s21::simd::min_element(first, last));
+    EXPECT_EQ(std::max_element(first, last),
+              s21::simd::max_element(first, last));
+    EXPECT_EQ(std::accumulate(first, last, s21::simd::sum_type<T>(0)),
+              s21::simd::sum(first, last));
+  }
+}
+}  // namespace
+
+TEST(TestSimd, Int32MatchesStd) { CheckAgainstStd<int32_t>(); }
+
+TEST(TestSimd, FloatMatchesStd) { CheckAgainstStd<float>(); }
+
+TEST(TestSimd, DoubleMatchesStd) { CheckAgainstStd<double>(); }
+
+TEST(TestSimd, ScalarTypesMatchStd) {
+  CheckAgainstStd<int16_t>();
+  CheckAgainstStd<int64_t>();
+}
+
+TEST(TestSimd, FirstOfEqualExtremes) {
+  s21::vector<int32_t> vec(40);
+  vec[13] = -3;
+  vec[29] = -3;
+  vec[17] = 8;
+  vec[31] = 8;
+  EXPECT_EQ(vec.data() + 13, s21::simd::min_element(vec));
+  EXPECT_EQ(vec.data() + 17, s21::simd::max_element(vec));
+}
+
+TEST(TestSimd, SumWidensIntegers) {
+  s21::vector<int32_t> vec;
+  vec.resize(100, 2000000000);
+  EXPECT_EQ(200000000000, s21::simd::sum(vec));
+}
+
+TEST(TestSimd, Containers) {
+  s21::array<float, 10> arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  EXPECT_EQ(arr.data_ + 6, s21::simd::find(arr, 7.0f));
+  EXPECT_TRUE(s21::simd::contains(arr, 10.0f));
+  EXPECT_FALSE(s21::simd::contains(arr, 11.0f));
+  EXPECT_FLOAT_EQ(55, s21::simd::sum(arr));
+
+  s21::vector<int32_t> vec({4, 1, 4, 9, 4, 2, 4, 4, 4, 0});
+  EXPECT_EQ(6, s21::simd::count(vec, 4));
+  EXPECT_EQ(vec.data() + 9, s21::simd::min_element(vec));
+  EXPECT_EQ(vec.data() + 3, s21::simd::max_element(vec));
+}
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && \
+    (defined(__GNUC__) || defined(__clang__))
+TEST(TestSimd, Sse2Kernels) {
+  s21::vector<int32_t> vec = RandomVector<int32_t>(101, 42);
+  const int32_t *first = vec.data();
+  const int32_t *last = vec.data() + vec.size();
+  EXPECT_EQ(std::find(first, last, vec[77]),
+            s21::simd::detail::FindSse2(first, last, vec[77]));
+  EXPECT_EQ(static_cast<size_t>(std::count(first, last, vec[5])),
+            s21::simd::detail::CountSse2(first, last, vec[5]));
+  EXPECT_EQ(std::min_element(first, last),
+            (s21::simd::detail::ExtremeSse2<int32_t, true>(first, last)));
+  EXPECT_EQ(std::max_element(first, last),
+            (s21::simd::detail::ExtremeSse2<int32_t, false>(first, last)));
+  EXPECT_EQ(std::accumulate(first, last, int64_t(0)),
+            s21::simd::detail::SumSse2(first, last));
+}
+#endif
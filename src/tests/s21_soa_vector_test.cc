@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "../containers/s21_soa_vector.h"
+
+namespace {
+struct ThrowOnCopy {
+  static int copies_left;
+  int value = 0;
+  ThrowOnCopy() = default;
+  explicit ThrowOnCopy(int v) : value(v) {}
+  ThrowOnCopy(const ThrowOnCopy &other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy");
+  }
+  ThrowOnCopy(ThrowOnCopy &&other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("move");
+  }
+};
+
+int ThrowOnCopy::copies_left = 1000;
+}  // namespace
+
+TEST(TestSoaVector, PushBackAndColumns) {
+  s21::soa_vector<int, double, std::string> vec;
+  EXPECT_TRUE(vec.empty());
+  for (int i = 0; i < 100; ++i) {
+    vec.push_back({i, i * 0.5, std::to_string(i)});
+  }
+  ASSERT_EQ(100, vec.size());
+  auto ids = vec.column<0>();
+  auto prices = vec.column<1>();
+  auto names = vec.column<2>();
+  ASSERT_EQ(100, ids.size());
+  EXPECT_EQ(4950, std::accumulate(ids.begin(), ids.end(), 0));
+  EXPECT_EQ(24.5, prices[49]);
+  EXPECT_EQ("99", names[99]);
+  EXPECT_EQ(ids.data() + 100, ids.end());
+}
+
+TEST(TestSoaVector, EmplaceBackReturnsReference) {
+  s21::soa_vector<int, std::string> vec;
+  auto [id, name] = vec.emplace_back(7, "seven");
+  EXPECT_EQ(7, id);
+  name += "!";
+  EXPECT_EQ("seven!", std::get<1>(vec[0]));
+}
+
+TEST(TestSoaVector, ProxyReferencesWriteThrough) {
+  s21::soa_vector<int, double> vec = {{1, 1.0}, {2, 2.0}, {3, 3.0}};
+  for (auto [id, price] : vec) {
+    price *= id;
+  }
+  EXPECT_EQ(9.0, vec.column<1>()[2]);
+  std::get<0>(vec.at(1)) = 20;
+  EXPECT_EQ(20, vec.column<0>()[1]);
+  EXPECT_EQ(1, std::get<0>(vec.front()));
+  EXPECT_EQ(3, std::get<0>(vec.back()));
+  EXPECT_THROW(vec.at(3), std::out_of_range);
+}
+
+TEST(TestSoaVector, ConstAccess) {
+  const s21::soa_vector<int, char> vec = {{1, 'a'}, {2, 'b'}};
+  int sum = 0;
+  for (auto [id, letter] : vec) {
+    sum += id;
+    EXPECT_EQ('a' + id - 1, letter);
+  }
+  EXPECT_EQ(3, sum);
+  EXPECT_EQ(2, vec.cend() - vec.cbegin());
+  auto letters = vec.column<1>();
+  EXPECT_EQ('b', letters[1]);
+  s21::soa_vector<int, char>::value_type last = vec.back();
+  EXPECT_EQ(std::make_tuple(2, 'b'), last);
+}
+
+TEST(TestSoaVector, IteratorArithmetic) {
+  s21::soa_vector<int> vec;
+  for (int i = 0; i < 10; ++i) vec.emplace_back(i);
+  auto it = vec.begin() + 4;
+  EXPECT_EQ(4, std::get<0>(*it));
+  EXPECT_EQ(6, std::get<0>(it[2]));
+  --it;
+  EXPECT_EQ(3, it - vec.begin());
+  s21::soa_vector<int>::const_iterator cit = it;
+  EXPECT_TRUE(cit == it);
+  EXPECT_TRUE(vec.begin() < cit);
+  EXPECT_EQ(10, std::count_if(vec.begin(), vec.end(),
+                              [](auto ref) { return std::get<0>(ref) < 10; }));
+}
+
+TEST(TestSoaVector, ReserveResizeShrink) {
+  s21::soa_vector<int, std::string> vec;
+  vec.reserve(50);
+  EXPECT_GE(vec.capacity(), 50);
+  const int *ids = vec.column<0>().data();
+  for (int i = 0; i < 50; ++i) vec.emplace_back(i, "x");
+  EXPECT_EQ(ids, vec.column<0>().data());
+  vec.resize(10);
+  EXPECT_EQ(10, vec.size());
+  vec.resize(12);
+  EXPECT_EQ(0, std::get<0>(vec[11]));
+  EXPECT_EQ("", std::get<1>(vec[11]));
+  vec.shrink_to_fit();
+  EXPECT_EQ(12, vec.capacity());
+  vec.pop_back();
+  EXPECT_EQ(11, vec.size());
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+}
+
+TEST(TestSoaVector, PushBackOwnElement) {
+  s21::soa_vector<std::string, int> vec;
+  vec.emplace_back(std::string(50, 'a'), 1);
+  for (int i = 0; i < 20; ++i) {
+    auto [name, id] = vec[0];
+    vec.emplace_back(name, id);
+  }
+  for (auto [name, id] : vec) {
+    EXPECT_EQ(std::string(50, 'a'), name);
+    EXPECT_EQ(1, id);
+  }
+}
+
+TEST(TestSoaVector, CopyAndMove) {
+  s21::soa_vector<int, std::string> vec = {{1, "one"}, {2, "two"}};
+  s21::soa_vector<int, std::string> copy = vec;
+  std::get<1>(copy[0]) = "uno";
+  EXPECT_EQ("one", std::get<1>(vec[0]));
+  s21::soa_vector<int, std::string> moved = std::move(vec);
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ("two", std::get<1>(moved[1]));
+  vec = copy;
+  EXPECT_EQ("uno", std::get<1>(vec[0]));
+  copy = std::move(moved);
+  EXPECT_EQ("one", std::get<1>(copy[0]));
+}
+
+TEST(TestSoaVector, ThrowingRelocationKeepsElements) {
+  s21::soa_vector<int, ThrowOnCopy> vec;
+  ThrowOnCopy::copies_left = 1000;
+  for (int i = 0; i < 8; ++i) vec.emplace_back(i, ThrowOnCopy(i));
+  ThrowOnCopy::copies_left = 4;
+  size_t capacity = vec.capacity();
+  EXPECT_THROW(vec.reserve(capacity * 4), std::runtime_error);
+  EXPECT_EQ(capacity, vec.capacity());
+  ASSERT_EQ(8, vec.size());
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(i, std::get<1>(vec[i]).value);
+  ThrowOnCopy::copies_left = 1000;
+}
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "../containers/s21_sort.h"
+#include "../containers/s21_vector.h"
+
+namespace {
+s21::vector<int> RandomInts(size_t size, int max_value, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, max_value);
+  s21::vector<int> vec;
+  for (size_t i = 0; i < size; ++i) {
+    vec.push_back(dist(gen));
+  }
+  return vec;
+}
+
+void ExpectSortedLike(s21::vector<int> &sorted, s21::vector<int> original) {
+  std::sort(original.begin(), original.end());
+  ASSERT_EQ(original.size(), sorted.size());
+  EXPECT_TRUE(std::equal(sorted.begin(), sorted.end(), original.begin()));
+}
+
+// Counts comparisons to check that a pattern does not go quadratic
+struct CountingLess {
+  long long *calls;
+  bool operator()(int a, int b) const {
+    ++*calls;
+    return a < b;
+  }
+};
+
+struct ThrowingLess {
+  bool operator()(int a, int b) const {
+    if (a == 777 || b == 777) {
+      throw std::runtime_error("comparison failed");
+    }
+    return a < b;
+  }
+};
+}  // namespace
+
+TEST(TestSort, SmallSizes) {
+  for (size_t size = 0; size < 300; ++size) {
+    s21::vector<int> vec = RandomInts(size, 50, static_cast<unsigned>(size));
+    s21::vector<int> original = vec;
+    s21::sort(vec);
+    ExpectSortedLike(vec, original);
+  }
+}
+
+TEST(TestSort, Patterns) {
+  const int size = 100000;
+  s21::vector<s21::vector<int>> inputs;
+  s21::vector<int> ascending, descending, equal, organ_pipe, sawtooth;
+  for (int i = 0; i < size; ++i) {
+    ascending.push_back(i);
+    descending.push_back(size - i);
+    equal.push_back(7);
+    organ_pipe.push_back(i < size / 2 ? i : size - i);
+    sawtooth.push_back(i % 1000);
+  }
+  inputs.push_back(ascending);
+  inputs.push_back(descending);
+  inputs.push_back(equal);
+  inputs.push_back(organ_pipe);
+  inputs.push_back(sawtooth);
+  inputs.push_back(RandomInts(size, 10, 1));
+  inputs.push_back(RandomInts(size, size, 2));
+
+  for (auto &input : inputs) {
+    s21::vector<int> vec = input;
+    long long calls = 0;
+    s21::sort(vec, CountingLess{&calls});
+    ExpectSortedLike(vec, input);
+    EXPECT_LT(calls, 3LL * size * 17);
+  }
+}
+
+TEST(TestSort, Comparator) {
+  s21::vector<int> vec = RandomInts(1000, 100, 3);
+  s21::sort(vec, std::greater<>());
+  EXPECT_TRUE(std::is_sorted(vec.begin(), vec.end(), std::greater<>()));
+}
+
+TEST(TestSort, Strings) {
+  s21::vector<std::string> vec;
+  for (int i = 0; i < 500; ++i) {
+    vec.push_back(std::to_string((i * 7919) % 500));
+  }
+  s21::sort(vec.begin(), vec.end());
+  EXPECT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+  EXPECT_EQ("0", vec.front());
+  EXPECT_EQ("99", vec.back());
+}
+
+TEST(TestSort, ParallelSort) {
+  for (unsigned threads : {1u, 2u, 3u, 8u}) {
+    s21::vector<int> vec = RandomInts(300000, 1 << 30, threads);
+    s21::vector<int> original = vec;
+    s21::parallel_sort(vec, std::less<>(), threads);
+    ExpectSortedLike(vec, original);
+  }
+}
+
+TEST(TestSort, ParallelSortDuplicates) {
+  s21::vector<int> vec = RandomInts(500000, 3, 4);
+  s21::vector<int> original = vec;
+  s21::parallel_sort(vec, std::less<>(), 8);
+  ExpectSortedLike(vec, original);
+}
+
+TEST(TestSort, ParallelSortStrings) {
+  s21::vector<std::string> vec;
+  for (int i = 0; i < 100000; ++i) {
+    vec.push_back(std::to_string((i * 7919) % 100000));
+  }
+  s21::parallel_sort(vec.begin(), vec.end(), std::less<>(), 4);
+  EXPECT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+  EXPECT_EQ(100000, vec.size());
+}
+
+TEST(TestSort, ParallelSortRethrows) {
+  s21::vector<int> vec = RandomInts(200000, 1000, 5);
+  vec[150000] = 777;
+  EXPECT_THROW(s21::parallel_sort(vec, ThrowingLess(), 4),
+               std::runtime_error);
+}
+
+namespace {
+template <typename T>
+void CheckRadixSort(T low, T high) {
+  std::mt19937_64 gen(11);
+  s21::vector<T> vec;
+  for (int i = 0; i < 5000; ++i) {
+    if constexpr (std::is_floating_point_v<T>) {
+      vec.push_back(std::uniform_real_distribution<T>(low, high)(gen));
+    } else {
+      vec.push_back(std::uniform_int_distribution<T>(low, high)(gen));
+    }
+  }
+  s21::vector<T> expected = vec;
+  std::sort(expected.begin(), expected.end());
+  s21::radix_sort(vec);
+  EXPECT_TRUE(std::equal(vec.begin(), vec.end(), expected.begin()));
+}
+
+struct Record {
+  uint32_t id;
+  std::string name;
+};
+}  // namespace
+
+TEST(TestSort, RadixSortIntegers) {
+  CheckRadixSort<uint32_t>(0, UINT32_MAX);
+  CheckRadixSort<uint64_t>(0, UINT64_MAX);
+  CheckRadixSort<int32_t>(INT32_MIN, INT32_MAX);
+  CheckRadixSort<int64_t>(-1000, 1000);
+  CheckRadixSort<int16_t>(INT16_MIN, INT16_MAX);
+  CheckRadixSort<uint64_t>(0, 300);
+}
+
+TEST(TestSort, RadixSortFloats) {
+  CheckRadixSort<float>(-1e6f, 1e6f);
+  CheckRadixSort<double>(-1e300, 1e300);
+  CheckRadixSort<double>(0, 1);
+
+  s21::vector<double> vec({0.5, -0.0, 1e-310, -INFINITY, 0.0, INFINITY,
+                           -1e-310, -2.5});
+  s21::radix_sort(vec);
+  EXPECT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+  EXPECT_TRUE(std::signbit(vec[3]));
+  EXPECT_FALSE(std::signbit(vec[4]));
+}
+
+TEST(TestSort, RadixSortProjectionIsStable) {
+  s21::vector<Record> records;
+  for (uint32_t i = 0; i < 1000; ++i) {
+    records.push_back({(i * 7919) % 10, std::to_string(i)});
+  }
+  s21::radix_sort(records, &Record::id);
+  for (size_t i = 1; i < records.size(); ++i) {
+    ASSERT_LE(records[i - 1].id, records[i].id);
+    if (records[i - 1].id == records[i].id) {
+      EXPECT_LT(std::stoi(records[i - 1].name), std::stoi(records[i].name));
+    }
+  }
+
+  s21::radix_sort(records.begin(), records.end(), [](const Record &record) {
+    return -static_cast<int>(record.id);
+  });
+  EXPECT_EQ(9, records.front().id);
+  EXPECT_EQ(0, records.back().id);
+}
@@ -0,0 +1,288 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../containers/s21_vector.h"
+
+namespace {
+// Bits as a string of 0s and 1s, for compact expectations
+std::string Bits(const s21::vector<bool> &vec) {
+  std::string result;
+  for (bool bit : vec) result += bit ? '1' : '0';
+  return result;
+}
+
+template <typename T>
+struct StatefulAllocator {
+  using value_type = T;
+
+  explicit StatefulAllocator(int id = 0) : id(id) {}
+  template <typename U>
+  StatefulAllocator(const StatefulAllocator<U> &other) : id(other.id) {}
+
+  T *allocate(size_t n) { return std::allocator<T>().allocate(n); }
+  void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  template <typename U>
+  bool operator==(const StatefulAllocator<U> &other) const {
+    return id == other.id;
+  }
+  template <typename U>
+  bool operator!=(const StatefulAllocator<U> &other) const {
+    return id != other.id;
+  }
+
+  int id;
+};
+}  // namespace
+
+TEST(TestVectorBool, PacksBitsIntoWords) {
+  s21::vector<bool> vec(130);
+  EXPECT_EQ(130, vec.size());
+  EXPECT_GE(vec.capacity(), 130);
+  EXPECT_EQ(0, vec.capacity() % 64);
+  vec[0] = true;
+  vec[65] = true;
+  vec[129] = true;
+  EXPECT_EQ(1u, vec.data()[0]);
+  EXPECT_EQ(2u, vec.data()[1]);
+  EXPECT_EQ(2u, vec.data()[2]);
+}
+
+TEST(TestVectorBool, ProxyReferences) {
+  s21::vector<bool> vec = {true, false, true};
+  s21::vector<bool>::reference first = vec[0];
+  first.flip();
+  EXPECT_FALSE(vec[0]);
+  EXPECT_TRUE(~first);
+  vec[1] = vec[2];
+  EXPECT_TRUE(vec.at(1));
+  swap(vec.front(), vec.back());
+  EXPECT_TRUE(vec[0]);
+  EXPECT_FALSE(vec[2]);
+  EXPECT_THROW(vec.at(3), std::out_of_range);
+  const s21::vector<bool> &cvec = vec;
+  EXPECT_TRUE(cvec.front());
+  EXPECT_FALSE(cvec.back());
+}
+
+TEST(TestVectorBool, IteratorsWorkWithAlgorithms) {
+  s21::vector<bool> vec;
+  for (int i = 0; i < 200; ++i) vec.push_back(i % 3 == 0);
+  EXPECT_EQ(200, vec.end() - vec.begin());
+  EXPECT_EQ(67, std::count(vec.cbegin(), vec.cend(), true));
+  std::reverse(vec.begin(), vec.end());
+  EXPECT_TRUE(vec[199]);
+  EXPECT_FALSE(vec[0]);
+  EXPECT_TRUE(vec[1]);
+  auto it = vec.end();
+  it -= 70;
+  EXPECT_EQ(130, it - vec.begin());
+  EXPECT_EQ(vec[135], it[5]);
+  for (auto bit : vec) bit = true;
+  EXPECT_EQ(200, vec.count());
+}
+
+TEST(TestVectorBool, CountAndFind) {
+  s21::vector<bool> vec(1000);
+  EXPECT_TRUE(vec.none());
+  EXPECT_EQ(s21::vector<bool>::npos, vec.find_first());
+  for (size_t pos : {3, 64, 65, 500, 999}) vec[pos] = true;
+  EXPECT_TRUE(vec.any());
+  EXPECT_EQ(5, vec.count());
+  EXPECT_EQ(3, vec.find_first());
+  EXPECT_EQ(64, vec.find_next(3));
+  EXPECT_EQ(65, vec.find_next(64));
+  EXPECT_EQ(500, vec.find_next(65));
+  EXPECT_EQ(999, vec.find_next(500));
+  EXPECT_EQ(s21::vector<bool>::npos, vec.find_next(999));
+}
+
+TEST(TestVectorBool, RankAndSelect) {
+  s21::vector<bool> vec(300);
+  for (size_t pos = 0; pos < 300; pos += 7) vec[pos] = true;
+  EXPECT_EQ(0, vec.rank(0));
+  EXPECT_EQ(1, vec.rank(1));
+  EXPECT_EQ(10, vec.rank(64));
+  EXPECT_EQ(vec.count(), vec.rank(300));
+  EXPECT_THROW(vec.rank(301), std::out_of_range);
+  for (size_t k = 0; k < vec.count(); ++k) {
+    EXPECT_EQ(k * 7, vec.select(k));
+    EXPECT_EQ(k, vec.rank(vec.select(k)));
+  }
+  EXPECT_EQ(s21::vector<bool>::npos, vec.select(vec.count()));
+}
+
+TEST(TestVectorBool, BitwiseOperations) {
+  s21::vector<bool> lhs(100);
+  s21::vector<bool> rhs(100);
+  for (size_t i = 0; i < 100; i += 2) lhs[i] = true;
+  for (size_t i = 0; i < 100; i += 3) rhs[i] = true;
+  EXPECT_EQ(17, (lhs & rhs).count());
+  EXPECT_EQ(67, (lhs | rhs).count());
+  EXPECT_EQ(50, (lhs ^ rhs).count());
+  lhs ^= lhs;
+  EXPECT_TRUE(lhs.none());
+  s21::vector<bool> shorter(99);
+  EXPECT_THROW(lhs &= shorter, std::invalid_argument);
+}
+
+TEST(TestVectorBool, FlipKeepsBitsPastSizeZero) {
+  s21::vector<bool> vec(70);
+  vec.flip();
+  EXPECT_EQ(70, vec.count());
+  EXPECT_EQ(0x3Fu, vec.data()[1]);
+  vec.resize(66);
+  EXPECT_EQ(66, vec.count());
+  vec.resize(80);
+  EXPECT_EQ(66, vec.count());
+  s21::vector<bool> expected(66, true);
+  expected.resize(80);
+  EXPECT_TRUE(vec == expected);
+  vec.pop_back();
+  EXPECT_TRUE(vec != expected);
+}
+
+TEST(TestVectorBool, InsertAndErase) {
+  s21::vector<bool> vec(130);
+  vec[129] = true;
+  auto it = vec.insert(vec.cbegin() + 1, true);
+  EXPECT_EQ(1, it - vec.begin());
+  ASSERT_EQ(131, vec.size());
+  EXPECT_TRUE(vec[1]);
+  EXPECT_TRUE(vec[130]);
+  it = vec.erase(vec.cbegin(), vec.cbegin() + 2);
+  EXPECT_EQ(vec.begin(), it);
+  ASSERT_EQ(129, vec.size());
+  EXPECT_EQ(1, vec.count());
+  EXPECT_TRUE(vec.back());
+  vec.erase(vec.cend() - 1);
+  EXPECT_TRUE(vec.none());
+}
+
+TEST(TestVectorBool, CopyMoveAndClear) {
+  s21::vector<bool> vec(1000, true);
+  s21::vector<bool> copy = vec;
+  copy[10] = false;
+  EXPECT_TRUE(vec[10]);
+  s21::vector<bool> moved = std::move(vec);
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(1000, moved.count());
+  vec = copy;
+  EXPECT_EQ(999, vec.count());
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  moved.resize(1000);
+  EXPECT_TRUE(moved.none());
+  moved.shrink_to_fit();
+  EXPECT_EQ(1024, moved.capacity());
+}
+
+TEST(TestVectorBool, InlineBits) {
+  s21::small_vector<bool, 100> vec = {true, false, true};
+  const auto *inline_words = vec.data();
+  for (int i = 0; i < 97; ++i) vec.push_back(true);
+  EXPECT_EQ(inline_words, vec.data());
+  EXPECT_EQ(128, vec.capacity());
+  s21::small_vector<bool, 100> moved = std::move(vec);
+  EXPECT_EQ(99, moved.count());
+  EXPECT_TRUE(vec.empty());
+  s21::small_vector<bool, 100> heap(1000, true);
+  heap.swap(moved);
+  EXPECT_EQ(1000, moved.count());
+  EXPECT_EQ(99, heap.count());
+  moved.resize(10);
+  moved.shrink_to_fit();
+  EXPECT_EQ(128, moved.capacity());
+  EXPECT_EQ(10, moved.count());
+}
+
+TEST(TestVectorBool, InlineSwapWithUnequalAllocators) {
+  using Small = s21::small_vector<bool, 64, StatefulAllocator<bool>>;
+  using Plain = s21::vector<bool, StatefulAllocator<bool>>;
+  static_assert(
+      !noexcept(std::declval<Small &>().swap(std::declval<Small &>())));
+  static_assert(
+      noexcept(std::declval<Plain &>().swap(std::declval<Plain &>())));
+  static_assert(noexcept(std::declval<s21::small_vector<bool, 64> &>().swap(
+      std::declval<s21::small_vector<bool, 64> &>())));
+
+  Small vec(10, true, StatefulAllocator<bool>(1));
+  Small other(200, true, StatefulAllocator<bool>(2));
+  vec.swap(other);
+  EXPECT_EQ(200, vec.count());
+  EXPECT_EQ(10, other.count());
+}
+
+TEST(TestVectorBool, ReallocatingAllocator) {
+  s21::vector<bool, s21::malloc_allocator<bool>> vec;
+  for (int i = 0; i < 100000; ++i) vec.push_back(i % 2 == 1);
+  EXPECT_EQ(50000, vec.count());
+  EXPECT_EQ(1, vec.find_first());
+  EXPECT_EQ(99999, vec.select(49999));
+}
+
+TEST(TestVectorBool, InsertManyAndEmplace) {
+  s21::vector<bool> vec;
+  vec.insert_many_back(true, 0, 1);
+  EXPECT_EQ("101", Bits(vec));
+  auto it = vec.insert_many(vec.cbegin() + 1, false, true, true);
+  EXPECT_EQ(vec.begin() + 1, it);
+  EXPECT_EQ("101101", Bits(vec));
+  EXPECT_EQ(vec.begin() + 2, vec.insert_many(vec.cbegin() + 2));
+  vec.insert_many_back();
+  EXPECT_EQ(6, vec.size());
+
+  it = vec.emplace(vec.cbegin(), true);
+  EXPECT_TRUE(*it);
+  vec.emplace(vec.cend());
+  s21::vector<bool>::reference last = vec.emplace_back(1);
+  EXPECT_TRUE(last);
+  last = false;
+  EXPECT_EQ("110110100", Bits(vec));
+}
+
+TEST(TestVectorBool, RangeInsertAndAppend) {
+  s21::vector<bool> vec(70, true);
+  bool items[] = {false, true, false};
+  auto it = vec.insert(vec.cbegin() + 64, items, items + 3);
+  EXPECT_EQ(vec.begin() + 64, it);
+  ASSERT_EQ(73, vec.size());
+  EXPECT_EQ("010", Bits(vec).substr(64, 3));
+  EXPECT_EQ(71, vec.count());
+
+  std::istringstream input("1 0 0 1");
+  vec.insert(vec.cbegin(), std::istream_iterator<int>(input),
+             std::istream_iterator<int>());
+  EXPECT_EQ("1001111", Bits(vec).substr(0, 7));
+  EXPECT_EQ(77, vec.size());
+
+  vec.append(items, 3);
+  EXPECT_EQ("010", Bits(vec).substr(77));
+  vec.append(items, 0);
+  EXPECT_EQ(80, vec.size());
+}
+
+TEST(TestVectorBool, EraseIfAndUnorderedErase) {
+  s21::vector<bool> vec;
+  for (int i = 0; i < 200; ++i) vec.push_back(i % 3 == 0);
+  EXPECT_EQ(133, vec.erase_if([](bool bit) { return !bit; }));
+  ASSERT_EQ(67, vec.size());
+  EXPECT_EQ(67, vec.count());
+  EXPECT_EQ(0, vec.erase_if([](bool bit) { return !bit; }));
+  EXPECT_EQ(7u, vec.data()[1]);
+
+  s21::vector<bool> other = {true, false, false, true, false};
+  auto it = other.unordered_erase(other.cbegin());
+  EXPECT_EQ("0001", Bits(other));
+  EXPECT_FALSE(*it);
+  other.unordered_erase(other.cend() - 1);
+  EXPECT_EQ("000", Bits(other));
+  EXPECT_TRUE(other.none());
+}
@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 #include "../containers/s21_vector.h"
@@ -539,4 +546,727 @@ TEST(TestVector, InsertManyBackEmpty) {
   EXPECT_EQ('o', vec[1]);
   EXPECT_EQ('o', vec[2]);
   EXPECT_EQ('l', vec[3]);
-}
\ No newline at end of file
+}
+namespace {
+struct Counted {
+  static inline int constructed = 0;
+  static inline int destroyed = 0;
+
+  Counted() { ++constructed; }
+  Counted(const Counted &) { ++constructed; }
+  Counted &operator=(const Counted &) = default;
+  ~Counted() { ++destroyed; }
+};
+}  // namespace
+
+TEST(TestVector, ReserveConstructsNothing) {
+  Counted::constructed = 0;
+  Counted::destroyed = 0;
+  {
+    s21::vector<Counted> vec;
+    vec.reserve(1000);
+    EXPECT_EQ(0, Counted::constructed);
+
+    vec.push_back(Counted());
+    vec.push_back(Counted());
+    EXPECT_EQ(4, Counted::constructed);
+    EXPECT_EQ(2, Counted::destroyed);
+
+    vec.pop_back();
+    EXPECT_EQ(3, Counted::destroyed);
+  }
+  EXPECT_EQ(Counted::constructed, Counted::destroyed);
+}
+
+TEST(TestVector, ClearDestroysElements) {
+  Counted::constructed = 0;
+  Counted::destroyed = 0;
+
+  s21::vector<Counted> vec(10);
+  EXPECT_EQ(10, Counted::constructed);
+  vec.clear();
+  EXPECT_EQ(10, Counted::destroyed);
+  EXPECT_EQ(10, vec.capacity());
+}
+
+namespace {
+// Copies throw once copies_left runs out
+struct CopyBomb {
+  static inline int alive = 0;
+  static inline int copies_left = 0;
+
+  CopyBomb() { ++alive; }
+  CopyBomb(const CopyBomb &) {
+    if (copies_left-- == 0) throw std::runtime_error("copy");
+    ++alive;
+  }
+  ~CopyBomb() { --alive; }
+};
+
+template <typename T>
+struct LiveAllocator {
+  using value_type = T;
+
+  LiveAllocator() = default;
+  template <typename U>
+  LiveAllocator(const LiveAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    ++live;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) {
+    --live;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  bool operator==(const LiveAllocator &) const { return true; }
+  bool operator!=(const LiveAllocator &) const { return false; }
+
+  static inline int live = 0;
+};
+}  // namespace
+
+TEST(TestVector, ThrowingCopyInConstructorsLeaksNothing) {
+  using Vector = s21::vector<CopyBomb, LiveAllocator<CopyBomb>>;
+  {
+    Vector source(20);
+    CopyBomb items[20];
+    CopyBomb::copies_left = 10;
+    EXPECT_THROW(Vector{source}, std::runtime_error);
+    CopyBomb::copies_left = 10;
+    EXPECT_THROW(Vector(items, items + 20), std::runtime_error);
+    EXPECT_EQ(40, CopyBomb::alive);
+    EXPECT_EQ(1, LiveAllocator<CopyBomb>::live);
+    CopyBomb::copies_left = 2;
+    EXPECT_THROW((Vector{CopyBomb(), CopyBomb(), CopyBomb()}),
+                 std::runtime_error);
+    EXPECT_EQ(40, CopyBomb::alive);
+    EXPECT_EQ(1, LiveAllocator<CopyBomb>::live);
+  }
+  EXPECT_EQ(0, CopyBomb::alive);
+  EXPECT_EQ(0, LiveAllocator<CopyBomb>::live);
+}
+
+namespace {
+struct MoveCounted {
+  static inline int copies = 0;
+  static inline int moves = 0;
+
+  MoveCounted() = default;
+  MoveCounted(const MoveCounted &) { ++copies; }
+  MoveCounted(MoveCounted &&) noexcept { ++moves; }
+  MoveCounted &operator=(const MoveCounted &) = default;
+  MoveCounted &operator=(MoveCounted &&) noexcept = default;
+};
+}  // namespace
+
+TEST(TestVector, GrowthMovesElements) {
+  s21::vector<MoveCounted> vec(4);
+  MoveCounted::copies = 0;
+  MoveCounted::moves = 0;
+
+  vec.reserve(100);
+  EXPECT_EQ(0, MoveCounted::copies);
+  EXPECT_EQ(4, MoveCounted::moves);
+}
+
+TEST(TestVector, GrowthKeepsStrings) {
+  s21::vector<std::string> vec;
+  for (int i = 0; i < 100; ++i) {
+    vec.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+  }
+
+  EXPECT_EQ(100, vec.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_EQ(std::string(40, static_cast<char>('a' + i % 26)), vec[i]);
+  }
+}
+
+TEST(TestVector, SwapKeepsBuffers) {
+  s21::vector<int> vec({1, 2, 3});
+  s21::vector<int> other({4, 5});
+  int *data = vec.data();
+
+  vec.swap(other);
+
+  EXPECT_EQ(2, vec.size());
+  EXPECT_EQ(3, other.size());
+  EXPECT_EQ(data, other.data());
+  EXPECT_EQ(4, vec[0]);
+  EXPECT_EQ(3, other[2]);
+}
+
+TEST(TestVector, EmplaceBack) {
+  s21::vector<std::string> vec;
+  auto &ref = vec.emplace_back(3, 'x');
+  EXPECT_EQ("xxx", ref);
+
+  for (int i = 0; i < 20; ++i) {
+    vec.emplace_back(vec.back());
+  }
+
+  EXPECT_EQ(21, vec.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_EQ("xxx", vec[i]);
+  }
+}
+
+TEST(TestVector, Emplace) {
+  s21::vector<std::string> vec({"a", "c"});
+  vec.reserve(10);
+
+  auto pos = vec.emplace(vec.begin() + 1, 2, 'b');
+  EXPECT_EQ("bb", *pos);
+  pos = vec.emplace(vec.begin(), vec[2]);
+  EXPECT_EQ("c", *pos);
+
+  EXPECT_EQ(4, vec.size());
+  EXPECT_EQ("c", vec[0]);
+  EXPECT_EQ("a", vec[1]);
+  EXPECT_EQ("bb", vec[2]);
+  EXPECT_EQ("c", vec[3]);
+
+  vec.shrink_to_fit();
+  pos = vec.emplace(vec.begin() + 2, vec[1]);
+  EXPECT_EQ("a", *pos);
+  EXPECT_EQ(5, vec.size());
+  EXPECT_EQ("bb", vec[3]);
+}
+
+TEST(TestVector, PushBackMovesRvalues) {
+  s21::vector<MoveCounted> vec;
+  vec.reserve(4);
+  MoveCounted::copies = 0;
+  MoveCounted::moves = 0;
+
+  MoveCounted item;
+  vec.push_back(std::move(item));
+  vec.insert(vec.begin(), MoveCounted());
+
+  EXPECT_EQ(0, MoveCounted::copies);
+  EXPECT_EQ(2, vec.size());
+}
+
+TEST(TestVector, InsertManyMiddleStrings) {
+  s21::vector<std::string> vec({"a", "e"});
+
+  auto pos = vec.insert_many(vec.begin() + 1, "b", std::string("c"), "d");
+  EXPECT_EQ("b", *pos);
+
+  EXPECT_EQ(5, vec.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_EQ(std::string(1, static_cast<char>('a' + i)), vec[i]);
+  }
+}
+
+TEST(TestVector, InsertManyOwnElements) {
+  s21::vector<std::string> vec({"x", "y", "z"});
+  vec.reserve(10);
+
+  vec.insert_many(vec.begin(), vec[2], vec[1]);
+
+  EXPECT_EQ(5, vec.size());
+  EXPECT_EQ("z", vec[0]);
+  EXPECT_EQ("y", vec[1]);
+  EXPECT_EQ("x", vec[2]);
+  EXPECT_EQ("y", vec[3]);
+  EXPECT_EQ("z", vec[4]);
+}
+
+TEST(TestVector, InsertManyShiftsTailOnce) {
+  s21::vector<MoveCounted> vec(6);
+  vec.reserve(20);
+  MoveCounted::copies = 0;
+  MoveCounted::moves = 0;
+
+  vec.insert_many(vec.begin() + 2, MoveCounted(), MoveCounted(),
+                  MoveCounted());
+
+  EXPECT_EQ(9, vec.size());
+  EXPECT_EQ(0, MoveCounted::copies);
+  EXPECT_EQ(4 + 3, MoveCounted::moves);
+}
+
+TEST(TestVector, EraseStrings) {
+  s21::vector<std::string> vec({"a", "b", "c", "d"});
+
+  vec.erase(vec.begin() + 1);
+  vec.erase(vec.end() - 1);
+
+  EXPECT_EQ(2, vec.size());
+  EXPECT_EQ("a", vec[0]);
+  EXPECT_EQ("c", vec[1]);
+}
+
+TEST(TestVector, RangeConstructor) {
+  std::list<int> origin({1, 2, 3, 4, 5});
+  s21::vector<int> vec(origin.begin(), origin.end());
+
+  EXPECT_EQ(5, vec.size());
+  EXPECT_EQ(5, vec.capacity());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_EQ(i + 1, vec[i]);
+  }
+}
+
+TEST(TestVector, AssignRange) {
+  s21::vector<std::string> vec({"old", "values"});
+  std::string items[] = {"a", "b", "c"};
+
+  vec.assign(std::begin(items), std::end(items));
+
+  EXPECT_EQ(3, vec.size());
+  EXPECT_EQ("a", vec[0]);
+  EXPECT_EQ("c", vec[2]);
+
+  std::istringstream stream("4 5 6 7");
+  s21::vector<int> nums({1});
+  nums.assign(std::istream_iterator<int>(stream),
+              std::istream_iterator<int>());
+  EXPECT_EQ(4, nums.size());
+  EXPECT_EQ(4, nums[0]);
+  EXPECT_EQ(7, nums[3]);
+}
+
+TEST(TestVector, InsertRange) {
+  s21::vector<int> vec({1, 2, 6});
+  int items[] = {3, 4, 5};
+
+  auto pos = vec.insert(vec.begin() + 2, items, items + 3);
+  EXPECT_EQ(3, *pos);
+
+  EXPECT_EQ(6, vec.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_EQ(i + 1, vec[i]);
+  }
+}
+
+TEST(TestVector, EraseRange) {
+  s21::vector<std::string> vec({"a", "b", "c", "d", "e"});
+
+  auto pos = vec.erase(vec.begin() + 1, vec.begin() + 3);
+  EXPECT_EQ("d", *pos);
+  EXPECT_EQ(3, vec.size());
+  EXPECT_EQ("a", vec[0]);
+  EXPECT_EQ("e", vec[2]);
+
+  pos = vec.erase(vec.begin(), vec.end());
+  EXPECT_EQ(vec.end(), pos);
+  EXPECT_TRUE(vec.empty());
+}
+
+TEST(TestVector, UnorderedErase) {
+  s21::vector<std::string> vec({"a", "b", "c", "d"});
+
+  auto pos = vec.unordered_erase(vec.cbegin() + 1);
+  EXPECT_EQ("d", *pos);
+  EXPECT_EQ(3, vec.size());
+  EXPECT_EQ("a", vec[0]);
+  EXPECT_EQ("c", vec[2]);
+
+  pos = vec.unordered_erase(vec.cend() - 1);
+  EXPECT_EQ(vec.end(), pos);
+  EXPECT_EQ(2, vec.size());
+
+  s21::vector<int> ints({1, 2, 3});
+  ints.unordered_erase(ints.cbegin());
+  EXPECT_EQ(3, ints[0]);
+  EXPECT_EQ(2, ints[1]);
+}
+
+TEST(TestVector, EraseIf) {
+  s21::vector<int> vec;
+  for (int i = 0; i < 1000; ++i) {
+    vec.push_back(i);
+  }
+
+  EXPECT_EQ(500, vec.erase_if([](int value) { return value % 2 != 0; }));
+  EXPECT_EQ(500, vec.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_EQ(static_cast<int>(i * 2), vec[i]);
+  }
+  EXPECT_EQ(0, vec.erase_if([](int value) { return value < 0; }));
+
+  s21::vector<std::string> strings({"keep", "drop", "keep", "drop"});
+  EXPECT_EQ(2, strings.erase_if(
+                   [](const std::string &value) { return value == "drop"; }));
+  EXPECT_EQ(2, strings.size());
+  EXPECT_EQ("keep", strings[1]);
+}
+
+TEST(TestVector, EraseIfDestroysOnce) {
+  Counted::constructed = 0;
+  Counted::destroyed = 0;
+  {
+    s21::vector<Counted> vec(10);
+    int calls = 0;
+    vec.erase_if([&calls](const Counted &) { return ++calls % 3 == 0; });
+    EXPECT_EQ(7, vec.size());
+    EXPECT_EQ(3, Counted::destroyed);
+  }
+  EXPECT_EQ(Counted::constructed, Counted::destroyed);
+}
+
+TEST(TestVector, Resize) {
+  s21::vector<int> vec({1, 2, 3});
+
+  vec.resize(6);
+  EXPECT_EQ(6, vec.size());
+  EXPECT_EQ(3, vec[2]);
+  EXPECT_EQ(0, vec[5]);
+
+  vec.resize(2);
+  EXPECT_EQ(2, vec.size());
+  EXPECT_EQ(2, vec[1]);
+
+  vec.resize(40, vec[0]);
+  EXPECT_EQ(40, vec.size());
+  EXPECT_EQ(1, vec[39]);
+}
+
+TEST(TestVector, Append) {
+  s21::vector<double> vec({0.5});
+  double buffer[] = {1.5, 2.5, 3.5};
+
+  vec.append(buffer, 3);
+  vec.append(vec.data(), vec.size());
+
+  EXPECT_EQ(8, vec.size());
+  EXPECT_DOUBLE_EQ(3.5, vec[3]);
+  EXPECT_DOUBLE_EQ(0.5, vec[4]);
+  EXPECT_DOUBLE_EQ(3.5, vec[7]);
+}
+
+TEST(TestVector, DefaultGrowthPolicy) {
+  s21::vector<int> vec;
+  vec.push_back(1);
+  EXPECT_EQ(8, vec.capacity());
+
+  vec.insert_many_back(2, 3, 4, 5, 6, 7, 8, 9);
+  EXPECT_GE(vec.capacity(), 12);
+  EXPECT_EQ(0, vec.capacity() * sizeof(int) % 16);
+}
+
+TEST(TestVector, DoublingGrowthPolicy) {
+  s21::vector<int, std::allocator<int>, s21::doubling_growth> vec;
+  for (int i = 0; i < 9; ++i) {
+    vec.push_back(i);
+  }
+  EXPECT_EQ(16, vec.capacity());
+
+  vec.resize(100);
+  EXPECT_EQ(100, vec.capacity());
+  for (int i = 0; i < 9; ++i) {
+    EXPECT_EQ(i, vec[i]);
+  }
+}
+
+TEST(TestVector, FixedIncrementGrowthPolicy) {
+  s21::vector<char, std::allocator<char>,
+              s21::fixed_increment_growth<64>> vec;
+  for (int i = 0; i < 65; ++i) {
+    vec.push_back('a');
+  }
+  EXPECT_EQ(128, vec.capacity());
+}
+
+TEST(TestVector, PageRoundedGrowthPolicy) {
+  s21::vector<double, std::allocator<double>, s21::page_rounded_growth<>> vec;
+  vec.push_back(1.0);
+  EXPECT_EQ(4096 / sizeof(double), vec.capacity());
+
+  vec.resize(513);
+  EXPECT_EQ(0, vec.capacity() * sizeof(double) % 4096);
+}
+
+namespace {
+template <typename T>
+struct TrackingAllocator {
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::true_type;
+
+  explicit TrackingAllocator(int id = 0) : id(id) {}
+  template <typename U>
+  TrackingAllocator(const TrackingAllocator<U> &other) : id(other.id) {}
+
+  T *allocate(size_t n) {
+    ++allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  bool operator==(const TrackingAllocator &other) const {
+    return id == other.id;
+  }
+  bool operator!=(const TrackingAllocator &other) const {
+    return id != other.id;
+  }
+
+  static inline int allocations = 0;
+  int id;
+};
+}  // namespace
+
+TEST(TestVector, AllocatorIsUsed) {
+  using Vector = s21::vector<std::string, TrackingAllocator<std::string>>;
+  TrackingAllocator<std::string>::allocations = 0;
+
+  Vector vec(TrackingAllocator<std::string>(7));
+  vec.push_back("a");
+  vec.reserve(100);
+
+  EXPECT_EQ(2, TrackingAllocator<std::string>::allocations);
+  EXPECT_EQ(7, vec.get_allocator().id);
+
+  Vector copy(vec);
+  EXPECT_EQ(7, copy.get_allocator().id);
+  EXPECT_EQ("a", copy[0]);
+}
+
+TEST(TestVector, AllocatorMoveAssignment) {
+  using Vector = s21::vector<std::string, TrackingAllocator<std::string>>;
+
+  Vector vec({"a", "b"}, TrackingAllocator<std::string>(1));
+  Vector same({"c"}, TrackingAllocator<std::string>(1));
+  Vector other({"d"}, TrackingAllocator<std::string>(2));
+
+  std::string *data = vec.data();
+  same = std::move(vec);
+  EXPECT_EQ(data, same.data());
+
+  other = std::move(same);
+  EXPECT_NE(data, other.data());
+  EXPECT_EQ(2, other.get_allocator().id);
+  EXPECT_EQ(2, other.size());
+  EXPECT_EQ("b", other[1]);
+}
+
+TEST(TestVector, AllocatorSwapPropagates) {
+  using Vector = s21::vector<int, TrackingAllocator<int>>;
+
+  Vector vec({1, 2}, TrackingAllocator<int>(1));
+  Vector other({3}, TrackingAllocator<int>(2));
+  vec.swap(other);
+
+  EXPECT_EQ(2, vec.get_allocator().id);
+  EXPECT_EQ(1, other.get_allocator().id);
+  EXPECT_EQ(3, vec[0]);
+}
+
+TEST(TestVector, InlineSwapWithUnequalAllocators) {
+  using Small = s21::small_vector<int, 4, TrackingAllocator<int>>;
+  static_assert(
+      !noexcept(std::declval<Small &>().swap(std::declval<Small &>())));
+  static_assert(noexcept(std::declval<s21::small_vector<int, 4> &>().swap(
+      std::declval<s21::small_vector<int, 4> &>())));
+  using Plain = s21::vector<int, TrackingAllocator<int>>;
+  static_assert(
+      noexcept(std::declval<Plain &>().swap(std::declval<Plain &>())));
+
+  Small vec({1, 2}, TrackingAllocator<int>(1));
+  Small other({3, 4, 5, 6, 7}, TrackingAllocator<int>(2));
+  vec.swap(other);
+  ASSERT_EQ(5, vec.size());
+  EXPECT_EQ(7, vec[4]);
+  ASSERT_EQ(2, other.size());
+  EXPECT_EQ(1, other[0]);
+}
+
+TEST(TestVector, SmallVectorStaysInline) {
+  TrackingAllocator<int>::allocations = 0;
+  s21::small_vector<int, 4, TrackingAllocator<int>> vec;
+  EXPECT_EQ(4, vec.capacity());
+
+  vec.insert_many_back(1, 2, 3, 4);
+  EXPECT_EQ(0, TrackingAllocator<int>::allocations);
+  auto *inline_data = vec.data();
+  EXPECT_GE(static_cast<void *>(inline_data), static_cast<void *>(&vec));
+  EXPECT_LT(static_cast<void *>(inline_data), static_cast<void *>(&vec + 1));
+
+  vec.push_back(5);
+  EXPECT_EQ(1, TrackingAllocator<int>::allocations);
+  EXPECT_NE(inline_data, vec.data());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_EQ(i + 1, vec[i]);
+  }
+
+  vec.resize(2);
+  vec.shrink_to_fit();
+  EXPECT_EQ(inline_data, vec.data());
+  EXPECT_EQ(4, vec.capacity());
+  EXPECT_EQ(2, vec[1]);
+}
+
+TEST(TestVector, SmallVectorMove) {
+  s21::small_vector<std::string, 2> small({"a", "b"});
+  s21::small_vector<std::string, 2> moved(std::move(small));
+
+  EXPECT_EQ(2, moved.size());
+  EXPECT_EQ("b", moved[1]);
+  EXPECT_TRUE(small.empty());
+
+  s21::small_vector<std::string, 2> big({"x", "y", "z"});
+  std::string *heap_data = big.data();
+  moved = std::move(big);
+  EXPECT_EQ(heap_data, moved.data());
+  EXPECT_EQ(3, moved.size());
+  EXPECT_EQ(2, big.capacity());
+
+  big.push_back("c");
+  moved.swap(big);
+  EXPECT_EQ(1, moved.size());
+  EXPECT_EQ("c", moved[0]);
+  EXPECT_EQ(heap_data, big.data());
+}
+
+TEST(TestVector, SmallVectorCopy) {
+  s21::small_vector<std::string, 3> vec({"a", "b", "c", "d"});
+  s21::small_vector<std::string, 3> copy(vec);
+  EXPECT_EQ(4, copy.size());
+  EXPECT_EQ("d", copy[3]);
+
+  vec.erase(vec.begin(), vec.begin() + 2);
+  copy = vec;
+  EXPECT_EQ(2, copy.size());
+  EXPECT_EQ("c", copy[0]);
+}
+
+TEST(TestVector, ReallocGrowth) {
+  s21::huge_vector<uint64_t> vec;
+  for (uint64_t i = 0; i < 100000; ++i) {
+    vec.push_back(i);
+  }
+  vec.push_back(vec[0]);
+  vec.insert(vec.begin() + 1, vec[99999]);
+
+  EXPECT_EQ(100002, vec.size());
+  EXPECT_EQ(0, vec[0]);
+  EXPECT_EQ(99999, vec[1]);
+  EXPECT_EQ(1, vec[2]);
+  EXPECT_EQ(99999, vec[100000]);
+  EXPECT_EQ(0, vec[100001]);
+
+  vec.shrink_to_fit();
+  EXPECT_EQ(vec.size(), vec.capacity());
+  vec.append(vec.data(), 1000);
+  EXPECT_EQ(101002, vec.size());
+  EXPECT_EQ(998, vec[101001]);
+}
+
+TEST(TestVector, ReallocGrowthWideInsert) {
+  struct Wide {
+    char bytes[100];
+  };
+  s21::huge_vector<Wide> vec(3);
+  vec[0].bytes[0] = 'a';
+  vec[2].bytes[99] = 'z';
+  vec.shrink_to_fit();
+  Wide items[5] = {};
+  items[4].bytes[50] = 'w';
+  vec.insert_many(vec.begin() + 1, items[0], items[1], items[2], items[3],
+                  items[4]);
+
+  EXPECT_EQ(8, vec.size());
+  EXPECT_EQ('a', vec[0].bytes[0]);
+  EXPECT_EQ('w', vec[5].bytes[50]);
+  EXPECT_EQ('z', vec[7].bytes[99]);
+}
+
+TEST(TestVector, ReallocGrowthSmallVector) {
+  s21::small_vector<int, 4, s21::malloc_allocator<int>> vec({1, 2, 3, 4, 5});
+  vec.resize(2);
+  vec.shrink_to_fit();
+  EXPECT_EQ(4, vec.capacity());
+
+  vec.insert_many(vec.begin(), 7, 8, 9);
+  EXPECT_EQ(5, vec.size());
+  EXPECT_EQ(7, vec[0]);
+  EXPECT_EQ(2, vec[4]);
+}
+
+TEST(TestVector, StaticVectorNeverAllocates) {
+  s21::static_vector<std::string, 4> vec;
+  EXPECT_EQ(4, vec.capacity());
+  EXPECT_EQ(4, vec.max_size());
+  auto *inline_data = vec.data();
+  EXPECT_GE(static_cast<void *>(inline_data), static_cast<void *>(&vec));
+  EXPECT_LT(static_cast<void *>(inline_data), static_cast<void *>(&vec + 1));
+
+  vec.push_back("b");
+  vec.emplace_back(2, 'd');
+  vec.insert(vec.begin(), "a");
+  vec.emplace(vec.cbegin() + 2, "c");
+  EXPECT_EQ(inline_data, vec.data());
+  EXPECT_EQ(4, vec.size());
+  EXPECT_EQ("a", vec[0]);
+  EXPECT_EQ("c", vec[2]);
+  EXPECT_EQ("dd", vec[3]);
+
+  vec.erase(vec.begin() + 1);
+  vec.resize(4, "e");
+  vec.shrink_to_fit();
+  EXPECT_EQ(inline_data, vec.data());
+  EXPECT_EQ(4, vec.capacity());
+  EXPECT_EQ("e", vec[3]);
+}
+
+TEST(TestVector, StaticVectorOverflowThrows) {
+  s21::static_vector<std::string, 3> vec({"a", "b", "c"});
+  EXPECT_THROW(vec.push_back("d"), std::length_error);
+  EXPECT_THROW(vec.insert(vec.begin(), "d"), std::length_error);
+  EXPECT_THROW(vec.resize(4), std::length_error);
+  EXPECT_THROW(vec.reserve(4), std::length_error);
+  ASSERT_EQ(3, vec.size());
+  EXPECT_EQ("a", vec[0]);
+  EXPECT_EQ("c", vec[2]);
+  EXPECT_THROW((s21::static_vector<int, 2>(3)), std::length_error);
+  EXPECT_THROW((s21::static_vector<int, 2>({1, 2, 3})), std::length_error);
+}
+
+TEST(TestVector, StaticVectorOfBoolsHoldsNBits) {
+  s21::static_vector<bool, 3> vec;
+  EXPECT_EQ(3, vec.capacity());
+  EXPECT_EQ(3, vec.max_size());
+  vec.push_back(true);
+  vec.push_back(false);
+  vec.push_back(true);
+  EXPECT_THROW(vec.push_back(true), std::length_error);
+  EXPECT_THROW(vec.insert(vec.cbegin(), false), std::length_error);
+  EXPECT_THROW(vec.resize(4), std::length_error);
+  ASSERT_EQ(3, vec.size());
+  EXPECT_EQ(2, vec.count());
+  EXPECT_THROW((s21::static_vector<bool, 64>(65)), std::length_error);
+  s21::static_vector<bool, 64> full(64, true);
+  EXPECT_EQ(64, full.count());
+}
+
+TEST(TestVector, StaticVectorCopyAndMove) {
+  s21::static_vector<std::string, 3> vec({"a", "b"});
+  s21::static_vector<std::string, 3> copy(vec);
+  s21::static_vector<std::string, 3> moved(std::move(vec));
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ("b", moved[1]);
+  copy.push_back("c");
+  moved.swap(copy);
+  EXPECT_EQ(3, moved.size());
+  EXPECT_EQ(2, copy.size());
+  vec = std::move(moved);
+  EXPECT_EQ("c", vec[2]);
+}
+
+TEST(TestVector, AlignedVector) {
+  s21::aligned_vector<float, 32> vec;
+  for (int i = 0; i < 1000; ++i) {
+    vec.push_back(static_cast<float>(i));
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(vec.data()) % 32);
+  }
+  s21::aligned_vector<char> bytes(3);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(bytes.data()) %
+                    s21::cache_line_size);
+  s21::aligned_vector<char> copy = bytes;
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(copy.data()) %
+                    s21::cache_line_size);
+  EXPECT_EQ(999.0f, vec.back());
+}